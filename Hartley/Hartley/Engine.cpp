@@ -26,6 +26,9 @@ Engine::Engine(NVLib::Parameters * parameters, LoggerBase * logger) : _parameter
     _startIndex = ArgUtils::GetInteger(parameters, "start");
 	_loopCount = ArgUtils::GetInteger(parameters, "count");
     _uniqueName = ArgUtils::GetString(parameters, "unique_name");
+    _manifestPath = ArgUtils::GetString(parameters, "manifest");
+    _outFolder = ArgUtils::GetString(parameters, "out_folder");
+    _force = ArgUtils::GetBoolean(parameters, "force");
 
     auto keys = vector<string>(); parameters->GetKeys(keys);
     for (auto& key : keys) 
@@ -55,22 +58,27 @@ void Engine::Run()
     auto path = string("../HartleyLib/libHartleyLib.so");
     auto loader = DLLoader<ModuleBase>(path);
 
+    // Find the pairs that have changed since the last successful run
+    auto statePath = NVLib::FileUtils::PathCombine(_outFolder, _uniqueName + ".state");
+    auto manifest = InputManifest(_folder, _manifestPath, statePath);
+    auto schedule = vector<InputPair *>(); manifest.GetSchedule(_startIndex, _loopCount, _force, schedule);
+    (*_logger) << "Pairs Found: " << manifest.GetPairs().size() << ", Scheduled: " << schedule.size() << LoggerBase::End();
+
     // Perform loop execution
-    for (auto i = 0; i < _loopCount; i++) 
+    for (auto pair : schedule) 
     {     
         // Update the parameter for the point file        
-        auto leftFile = stringstream(); leftFile << "left_" << setw(4) << setfill('0') << i << ".jpg";
-        auto rightFile = stringstream(); rightFile << "right_" << setw(4) << setfill('0') << i << ".jpg";
-        auto uniqueName = stringstream(); uniqueName << _uniqueName << "_" << setw(4) << setfill('0') << i;
-        auto leftPath = NVLib::FileUtils::PathCombine(_folder, leftFile.str());
-        auto rightPath = NVLib::FileUtils::PathCombine(_folder, rightFile.str());
-        _parameters->Add("left_image", leftPath); _parameters->Add("right_image", rightPath);
+        auto uniqueName = stringstream(); uniqueName << _uniqueName << "_" << setw(4) << setfill('0') << pair->GetIndex();
+        _parameters->Add("left_image", pair->GetLeftPath()); _parameters->Add("right_image", pair->GetRightPath());
         _parameters->Add("unique_name", uniqueName.str());
 
         // Perform the actual execution here
         loader.DLOpenLib();
-        PerformExecute(loader);
+        auto result = PerformExecute(loader);
         loader.DLCloseLib();
+
+        // Only record the pair once its output has been written
+        if (result == EXIT_SUCCESS) manifest.MarkComplete(pair);
     }
 }
 
@@ -81,11 +89,12 @@ void Engine::Run()
 /**
  * @brief Perform the module execution life cycle
  * @param loader The loader that we are using to launch the module
+ * @return int The result code of the module execution
  */
-void Engine::PerformExecute(DLLoader<ModuleBase>& loader) 
+int Engine::PerformExecute(DLLoader<ModuleBase>& loader) 
 {
     auto module = loader.DLGetInstance();
     module->SetLogger(_logger);
     module->Initialize(*_parameters);
-    module->Execute();
+    return module->Execute();
 }
@@ -18,6 +18,7 @@ using namespace std;
 #include <ModuleLib/ModuleBase.h>
 
 #include "Helpers/ArgUtils.h"
+#include "Helpers/InputManifest.h"
 
 #include "DLLoader.h"
 
@@ -33,6 +34,9 @@ namespace NVL_Module
 		int _startIndex;
 		int _loopCount;
 		string _uniqueName;
+		string _manifestPath;
+		string _outFolder;
+		bool _force;
 
 	public:
 		Engine(NVLib::Parameters* parameters, LoggerBase * logger);
@@ -40,6 +44,6 @@ namespace NVL_Module
 
 		void Run();
 	private:
-		void PerformExecute(DLLoader<ModuleBase>& loader);
+		int PerformExecute(DLLoader<ModuleBase>& loader);
 	};
 }
@@ -0,0 +1,231 @@
+//--------------------------------------------------
+// Implementation of class InputManifest
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "InputManifest.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param folder The folder that contains the input images
+ * @param manifestPath The path to a manifest file (scan the folder if this is empty)
+ * @param statePath The path to the file that records the pairs that were processed successfully
+ */
+InputManifest::InputManifest(const string& folder, const string& manifestPath, const string& statePath) : _folder(folder), _statePath(statePath)
+{
+	if (manifestPath == string()) ScanFolder();
+	else ReadManifest(manifestPath);
+
+	LoadState();
+}
+
+/**
+ * @brief Main Terminator
+ */
+InputManifest::~InputManifest()
+{
+	for (auto pair : _pairs) delete pair;
+}
+
+//--------------------------------------------------
+// Schedule
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the pairs that still need processing
+ * @param start The index of the first pair that we are interested in
+ * @param count The number of indices to consider (a negative value means all of them)
+ * @param force Schedule the pairs even if they have not changed since the last run
+ * @param schedule The pairs that need processing
+ * @remarks A pair has changed if its stamps differ from the last successful run, or from the stamps in the manifest
+ */
+void InputManifest::GetSchedule(int start, int count, bool force, vector<InputPair *>& schedule)
+{
+	for (auto pair : _pairs)
+	{
+		auto index = pair->GetIndex();
+		if (index < start || (count >= 0 && index >= start + count)) continue;
+
+		auto completed = _completed.find(index);
+		if (!force && !pair->GetModified() && completed != _completed.end() && completed->second == pair->GetSignature()) continue;
+
+		schedule.push_back(pair);
+	}
+}
+
+/**
+ * @brief Record that the given pair was processed successfully
+ * @param pair The pair that was processed
+ */
+void InputManifest::MarkComplete(InputPair * pair)
+{
+	_completed[pair->GetIndex()] = pair->GetSignature();
+
+	auto writer = ofstream(_statePath, ios::app);
+	if (!writer.is_open()) throw runtime_error("Unable to open: " + _statePath);
+	writer << pair->GetIndex() << " " << pair->GetSignature() << endl;
+	writer.close();
+}
+
+//--------------------------------------------------
+// Enumeration
+//--------------------------------------------------
+
+/**
+ * @brief Find the pairs within the folder by scanning it once
+ */
+void InputManifest::ScanFolder()
+{
+	auto lefts = map<int, string>(); auto rights = map<int, string>();
+
+	for (auto& entry : filesystem::directory_iterator(_folder))
+	{
+		if (!entry.is_regular_file()) continue;
+
+		auto fileName = entry.path().filename().string(); auto index = 0;
+		if (ParseIndex(fileName, "left_", index)) lefts[index] = entry.path().string();
+		else if (ParseIndex(fileName, "right_", index)) rights[index] = entry.path().string();
+	}
+
+	for (auto& left : lefts)
+	{
+		auto right = rights.find(left.first);
+		if (right == rights.end()) continue;
+
+		long long leftSize, leftTime, rightSize, rightTime;
+		GetFileStamp(left.second, leftSize, leftTime);
+		GetFileStamp(right->second, rightSize, rightTime);
+
+		_pairs.push_back(new InputPair(left.first, left.second, right->second, leftSize, leftTime, rightSize, rightTime));
+	}
+}
+
+/**
+ * @brief Read the pairs from a manifest file
+ * @param path The path to the manifest file
+ * @remarks Each line is "<index> <left> <right> [<left_size> <left_time> <right_size> <right_time>]".
+ * Relative paths are relative to the input folder. Pairs whose files are missing are left out, and the stamps are
+ * always read from disk. When a line gives stamps that differ from the disk, the pair is treated as changed.
+ */
+void InputManifest::ReadManifest(const string& path)
+{
+	auto reader = ifstream(path);
+	if (!reader.is_open()) throw runtime_error("Unable to open: " + path);
+
+	auto line = string();
+	while (getline(reader, line))
+	{
+		if (line.empty() || line[0] == '#') continue;
+
+		auto parser = stringstream(line);
+		auto index = 0; string leftFile, rightFile;
+		if (!(parser >> index >> leftFile >> rightFile)) throw runtime_error("Invalid manifest line: " + line);
+
+		auto leftPath = filesystem::path(leftFile).is_absolute() ? leftFile : NVLib::FileUtils::PathCombine(_folder, leftFile);
+		auto rightPath = filesystem::path(rightFile).is_absolute() ? rightFile : NVLib::FileUtils::PathCombine(_folder, rightFile);
+
+		if (!NVLib::FileUtils::Exists(leftPath) || !NVLib::FileUtils::Exists(rightPath)) continue;
+
+		long long leftSize, leftTime, rightSize, rightTime;
+		GetFileStamp(leftPath, leftSize, leftTime);
+		GetFileStamp(rightPath, rightSize, rightTime);
+		auto pair = new InputPair(index, leftPath, rightPath, leftSize, leftTime, rightSize, rightTime);
+
+		long long stamps[4];
+		if (parser >> stamps[0] >> stamps[1] >> stamps[2] >> stamps[3])
+		{
+			pair->GetModified() = stamps[0] != leftSize || stamps[1] != leftTime || stamps[2] != rightSize || stamps[3] != rightTime;
+		}
+
+		_pairs.push_back(pair);
+	}
+
+	reader.close();
+}
+
+//--------------------------------------------------
+// State
+//--------------------------------------------------
+
+/**
+ * @brief Load the signatures of the pairs that were processed by earlier runs
+ */
+void InputManifest::LoadState()
+{
+	if (!NVLib::FileUtils::Exists(_statePath)) return;
+
+	auto reader = ifstream(_statePath);
+	if (!reader.is_open()) throw runtime_error("Unable to open: " + _statePath);
+
+	auto line = string();
+	while (getline(reader, line))
+	{
+		auto parser = stringstream(line); auto index = 0;
+		if (!(parser >> index)) continue;
+
+		auto signature = string(); getline(parser >> ws, signature);
+		_completed[index] = signature;
+	}
+
+	reader.close();
+
+	// Compact the state file, since later runs append to it
+	SaveState();
+}
+
+/**
+ * @brief Rewrite the state file with a single entry per pair
+ */
+void InputManifest::SaveState()
+{
+	auto writer = ofstream(_statePath);
+	if (!writer.is_open()) throw runtime_error("Unable to open: " + _statePath);
+	for (auto& completed : _completed) writer << completed.first << " " << completed.second << endl;
+	writer.close();
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Extract the index from a file name of the form <prefix>XXXX.jpg
+ * @param fileName The name of the file
+ * @param prefix The expected prefix
+ * @param index The index that was extracted
+ * @return true If the file name matched the pattern
+ * @return false If the file name did not match the pattern
+ */
+bool InputManifest::ParseIndex(const string& fileName, const string& prefix, int& index)
+{
+	auto extension = string(".jpg");
+	if (fileName.size() <= prefix.size() + extension.size()) return false;
+	if (fileName.compare(0, prefix.size(), prefix) != 0) return false;
+	if (fileName.compare(fileName.size() - extension.size(), extension.size(), extension) != 0) return false;
+
+	auto number = fileName.substr(prefix.size(), fileName.size() - prefix.size() - extension.size());
+	for (auto character : number) if (!isdigit(character)) return false;
+
+	index = NVLib::StringUtils::String2Int(number);
+	return true;
+}
+
+/**
+ * @brief Retrieve the size and modification time of a file
+ * @param path The path to the file
+ * @param size The size of the file in bytes
+ * @param time The modification time of the file
+ */
+void InputManifest::GetFileStamp(const string& path, long long& size, long long& time)
+{
+	size = (long long) filesystem::file_size(path);
+	time = (long long) filesystem::last_write_time(path).time_since_epoch().count();
+}
@@ -0,0 +1,48 @@
+//--------------------------------------------------
+// Utility: Enumerates the stereo pairs within an input folder (or manifest) and tracks which have been processed
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+using namespace std;
+
+#include <NVLib/FileUtils.h>
+#include <NVLib/StringUtils.h>
+
+#include "InputPair.h"
+
+namespace NVL_Module
+{
+	class InputManifest
+	{
+	private:
+		string _folder;
+		string _statePath;
+		vector<InputPair *> _pairs;
+		map<int, string> _completed;
+	public:
+		InputManifest(const string& folder, const string& manifestPath, const string& statePath);
+		~InputManifest();
+
+		void GetSchedule(int start, int count, bool force, vector<InputPair *>& schedule);
+		void MarkComplete(InputPair * pair);
+
+		inline vector<InputPair *>& GetPairs() { return _pairs; }
+	private:
+		void ScanFolder();
+		void ReadManifest(const string& path);
+		void LoadState();
+		void SaveState();
+
+		bool ParseIndex(const string& fileName, const string& prefix, int& index);
+		void GetFileStamp(const string& path, long long& size, long long& time);
+	};
+}
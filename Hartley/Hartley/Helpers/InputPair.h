@@ -0,0 +1,51 @@
+//--------------------------------------------------
+// Model: A left/right image pair scheduled for processing
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <sstream>
+#include <iostream>
+using namespace std;
+
+namespace NVL_Module
+{
+	class InputPair
+	{
+	private:
+		int _index;
+		string _leftPath;
+		string _rightPath;
+		long long _leftSize;
+		long long _leftTime;
+		long long _rightSize;
+		long long _rightTime;
+		bool _modified;
+	public:
+		InputPair(int index, const string& leftPath, const string& rightPath, long long leftSize, long long leftTime, long long rightSize, long long rightTime) :
+			_index(index), _leftPath(leftPath), _rightPath(rightPath), _leftSize(leftSize), _leftTime(leftTime), _rightSize(rightSize), _rightTime(rightTime), _modified(false) {}
+
+		inline int& GetIndex() { return _index; }
+		inline string& GetLeftPath() { return _leftPath; }
+		inline string& GetRightPath() { return _rightPath; }
+		inline long long& GetLeftSize() { return _leftSize; }
+		inline long long& GetLeftTime() { return _leftTime; }
+		inline long long& GetRightSize() { return _rightSize; }
+		inline long long& GetRightTime() { return _rightTime; }
+		inline bool& GetModified() { return _modified; }
+
+		/**
+		 * @brief Generate a signature that changes whenever either image changes on disk
+		 * @return string The resultant signature
+		 */
+		inline string GetSignature()
+		{
+			auto result = stringstream(); result << _leftSize << " " << _leftTime << " " << _rightSize << " " << _rightTime;
+			return result.str();
+		}
+	};
+}
@@ -76,7 +76,9 @@ string GetParamKeys()
         "{@unique_name   |                       | A unique name for the output file }" 
         "{@out_folder    | Output                | The location of the output folder }" 
         "{start          | 0                     | The index of the first image }"
-        "{count          | 1                     | The number of files to process }"
+        "{count          | 1                     | The number of indices to process (-1 for all) }"
+        "{manifest       |                       | A manifest file listing the pairs (the folder is scanned if empty) }"
+        "{force          | false                 | Process pairs even if they have not changed since the last run }"
         "{zip            | false                 | Put the output in a zip file }"; 
 
     return string(keys);
@@ -104,6 +106,8 @@ NVLib::Parameters * GetParameters(int argc, char ** argv)
     parameters->Add("out_folder", parser.get<String>(2));
     parameters->Add("start", parser.get<String>("start"));
     parameters->Add("count", parser.get<String>("count"));
+    parameters->Add("manifest", parser.get<String>("manifest"));
+    parameters->Add("force", parser.get<String>("force"));
     parameters->Add("zip", parser.get<String>("zip"));
 
     return parameters;
@@ -0,0 +1,196 @@
+//--------------------------------------------------
+// Unit Tests for scheduling the input pairs
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <iomanip>
+
+#include <gtest/gtest.h>
+
+#include "../../Hartley/Helpers/InputManifest.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Write a file with the given number of bytes
+ * @param path The path of the file
+ * @param size The number of bytes
+ */
+static void WriteFile(const string& path, int size)
+{
+    auto writer = ofstream(path, ios::binary); writer << string(size, 'x'); writer.close();
+}
+
+/**
+ * @brief Build an input folder with pairs 0, 2 and 5, and a left image for 3 that has no right image
+ * @param folder The folder that is created (an existing one is replaced)
+ */
+static void BuildFolder(const string& folder)
+{
+    filesystem::remove_all(folder); filesystem::create_directories(folder);
+    for (auto index : { 0, 2, 5 })
+    {
+        auto number = stringstream(); number << setw(4) << setfill('0') << index;
+        WriteFile(folder + "/left_" + number.str() + ".jpg", 10); WriteFile(folder + "/right_" + number.str() + ".jpg", 10);
+    }
+    WriteFile(folder + "/left_0003.jpg", 10); WriteFile(folder + "/notes.txt", 10);
+}
+
+/**
+ * @brief Get the indices of the scheduled pairs
+ * @param manifest The manifest that is scheduling
+ * @param start The first index that we are interested in
+ * @param count The number of indices (negative for all of them)
+ * @param force Ignore the state of earlier runs
+ * @return vector<int> The indices of the scheduled pairs
+ */
+static vector<int> GetIndices(InputManifest& manifest, int start, int count, bool force)
+{
+    auto schedule = vector<InputPair *>(); manifest.GetSchedule(start, count, force, schedule);
+    auto result = vector<int>(); for (auto pair : schedule) result.push_back(pair->GetIndex());
+    return result;
+}
+
+/**
+ * @brief Count the lines of a file
+ * @param path The path of the file
+ * @return int The number of lines
+ */
+static int CountLines(const string& path)
+{
+    auto reader = ifstream(path); auto line = string(); auto result = 0;
+    while (getline(reader, line)) result++;
+    return result;
+}
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a folder scan keeps the gaps in the numbering and drops unmatched images
+ */
+TEST(InputManifest_Test, scan_gaps)
+{
+    // Setup
+    auto folder = string("InputManifest_Test_scan"); BuildFolder(folder);
+
+    // Execute
+    auto manifest = InputManifest(folder, string(), folder + "/run.state");
+    auto all = GetIndices(manifest, 0, -1, false);
+    filesystem::remove_all(folder);
+
+    // Confirm
+    ASSERT_EQ(all, vector<int>({ 0, 2, 5 }));
+}
+
+/**
+ * @brief Confirm that start and count select a range of indices rather than a range of positions
+ */
+TEST(InputManifest_Test, schedule_start)
+{
+    // Setup
+    auto folder = string("InputManifest_Test_start"); BuildFolder(folder);
+    auto manifest = InputManifest(folder, string(), folder + "/run.state");
+
+    // Execute
+    auto fromTwo = GetIndices(manifest, 2, -1, false);
+    auto firstThree = GetIndices(manifest, 0, 3, false);
+    auto middle = GetIndices(manifest, 1, 4, false);
+    filesystem::remove_all(folder);
+
+    // Confirm
+    ASSERT_EQ(fromTwo, vector<int>({ 2, 5 }));
+    ASSERT_EQ(firstThree, vector<int>({ 0, 2 }));
+    ASSERT_EQ(middle, vector<int>({ 2 }));
+}
+
+/**
+ * @brief Confirm that a rerun skips the pairs that have not changed, unless it is forced
+ */
+TEST(InputManifest_Test, rerun_skips_unchanged)
+{
+    // Setup
+    auto folder = string("InputManifest_Test_rerun"); BuildFolder(folder);
+    auto statePath = folder + "/run.state";
+    {
+        auto manifest = InputManifest(folder, string(), statePath);
+        for (auto pair : manifest.GetPairs()) manifest.MarkComplete(pair);
+    }
+    WriteFile(folder + "/right_0002.jpg", 20);
+
+    // Execute
+    auto manifest = InputManifest(folder, string(), statePath);
+    auto rerun = GetIndices(manifest, 0, -1, false);
+    auto forced = GetIndices(manifest, 0, -1, true);
+    filesystem::remove_all(folder);
+
+    // Confirm
+    ASSERT_EQ(rerun, vector<int>({ 2 }));
+    ASSERT_EQ(forced, vector<int>({ 0, 2, 5 }));
+}
+
+/**
+ * @brief Confirm that loading the state rewrites it with one line per pair
+ */
+TEST(InputManifest_Test, state_compaction)
+{
+    // Setup
+    auto folder = string("InputManifest_Test_state"); BuildFolder(folder);
+    auto statePath = folder + "/run.state";
+    {
+        auto manifest = InputManifest(folder, string(), statePath);
+        for (auto i = 0; i < 3; i++) for (auto pair : manifest.GetPairs()) manifest.MarkComplete(pair);
+    }
+    auto appended = CountLines(statePath);
+
+    // Execute
+    auto manifest = InputManifest(folder, string(), statePath);
+    auto compacted = CountLines(statePath);
+    auto rerun = GetIndices(manifest, 0, -1, false);
+    filesystem::remove_all(folder);
+
+    // Confirm
+    ASSERT_EQ(appended, 9);
+    ASSERT_EQ(compacted, 3);
+    ASSERT_TRUE(rerun.empty());
+}
+
+/**
+ * @brief Confirm that a manifest drops missing pairs and treats stamps that differ from the disk as changed
+ */
+TEST(InputManifest_Test, manifest_stamps)
+{
+    // Setup
+    auto folder = string("InputManifest_Test_manifest"); BuildFolder(folder);
+    auto statePath = folder + "/run.state"; auto manifestPath = folder + "/pairs.txt";
+    {
+        auto manifest = InputManifest(folder, string(), statePath);
+        for (auto pair : manifest.GetPairs()) manifest.MarkComplete(pair);
+    }
+
+    auto current = InputManifest(folder, string(), folder + "/other.state"); auto pair = current.GetPairs()[0];
+    auto writer = ofstream(manifestPath);
+    writer << "# index left right [stamps]" << endl;
+    writer << "0 left_0000.jpg right_0000.jpg " << pair->GetSignature() << endl;
+    writer << "2 left_0002.jpg right_0002.jpg 99 " << pair->GetLeftTime() << " 99 " << pair->GetRightTime() << endl;
+    writer << "3 left_0003.jpg right_0003.jpg 10 0 10 0" << endl;
+    writer << "5 left_0005.jpg right_0005.jpg" << endl;
+    writer.close();
+
+    // Execute
+    auto manifest = InputManifest(folder, manifestPath, statePath);
+    auto rerun = GetIndices(manifest, 0, -1, false);
+    auto count = (int)manifest.GetPairs().size();
+    filesystem::remove_all(folder);
+
+    // Confirm
+    ASSERT_EQ(count, 3);
+    ASSERT_EQ(rerun, vector<int>({ 2 }));
+}
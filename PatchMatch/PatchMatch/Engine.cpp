@@ -24,15 +24,24 @@ Engine::Engine(NVLib::Logger* logger, NVLib::Parameters* parameters)
 
     _logger->Log(1, "Loading general parameters");
     auto inputFolder = ArgUtils::GetString(parameters, "input_folder");
-    auto index1 = ArgUtils::GetInteger(parameters, "index_1");
-    auto index2 = ArgUtils::GetInteger(parameters, "index_2");
+    auto cacheLimit = ArgUtils::GetInteger(parameters, "cache_limit");
+    _batchMode = ArgUtils::GetBoolean(parameters, "batch_mode");
 
     _logger->Log(1, "Loading calibration");
     _calibration = new Calibration(inputFolder);
 
-    _logger->Log(1, "Loading Frames");
-    _frames.push_back(new Frame(inputFolder, index1));
-    _frames.push_back(new Frame(inputFolder, index2));
+    _logger->Log(1, "Creating a %i MB image cache for the frames", cacheLimit);
+    _cache = new ImageCache((size_t)cacheLimit << 20);
+
+    if (_batchMode) return;
+
+    auto referenceIndex = ArgUtils::GetInteger(parameters, "reference_index");
+    auto sourceIndices = ArgUtils::GetIntegers(parameters, "source_indices");
+
+    _logger->Log(1, "Loading Frames (a reference and %i sources)", (int)sourceIndices.size());
+    _frames.push_back(new Frame(inputFolder, referenceIndex));
+    for (auto index : sourceIndices) _frames.push_back(new Frame(inputFolder, index));
+    for (auto frame : _frames) frame->GetCache() = _cache;
 }
 
 /**
@@ -43,6 +52,7 @@ Engine::~Engine()
     delete _parameters;
     delete _calibration;
     for (auto frame : _frames) delete frame;
+    delete _cache;
 }
 
 //--------------------------------------------------
@@ -54,9 +64,221 @@ Engine::~Engine()
  */
 void Engine::Run()
 {
-    _logger->Log(1, "Determining a gradient map for each frame");
-    Mat gradientMap1 = NVLib::ImageUtils::GetGradientMap(_frames[0]->GetImage());
-    Mat gradientMap2 = NVLib::ImageUtils::GetGradientMap(_frames[1]->GetImage());
+    auto outputFolder = ArgUtils::GetString(_parameters, "output_folder");
+    auto settings = GetSettings();
+    NVLib::FileUtils::AddFolders(outputFolder);
+
+    if (_batchMode) RunBatch(outputFolder, settings); else RunSingle(outputFolder, settings);
+    _logger->Log(1, "Image cache: %i hits, %i misses, %i evictions", _cache->GetHits(), _cache->GetMisses(), _cache->GetEvictions());
+
+    auto fusionIndices = ArgUtils::GetIntegers(_parameters, "fusion_indices");
+    if (!fusionIndices.empty()) Fuse(outputFolder, fusionIndices);
+}
+
+//--------------------------------------------------
+// Matching
+//--------------------------------------------------
+
+/**
+ * Match the reference that is named in the parameters against its sources
+ * @param outputFolder The folder that the maps are saved to
+ * @param settings The settings of the run
+ */
+void Engine::RunSingle(const string& outputFolder, MatchSettings& settings)
+{
+    auto tileSize = ArgUtils::GetInteger(_parameters, "tile_size");
+    auto tileHalo = ArgUtils::GetInteger(_parameters, "tile_halo");
+
+    auto sources = vector<Frame *>(_frames.begin() + 1, _frames.end());
+    Mat depth, confidence;
+
+    if (tileSize > 0)
+    {
+        _logger->Log(1, "Running PatchMatch in %i pixel tiles (with a %i pixel halo)", tileSize, tileHalo);
+        auto matcher = TiledMatcher(_calibration, _frames[0], sources, settings, tileSize, tileHalo);
+        matcher.Run();
+        _logger->Log(1, "PatchMatch ran %i tiles and %i pixel updates", matcher.GetTileCount(), (int)matcher.GetUpdates());
+        depth = matcher.GetDepth(); confidence = matcher.GetConfidence();
+    }
+    else
+    {
+        _logger->Log(1, "Running PatchMatch");
+        auto matcher = PatchMatcher(_calibration, _frames[0], sources, settings);
+        matcher.Run();
+        _logger->Log(1, "PatchMatch ran %i iterations and %i pixel updates", matcher.GetPasses(), (int)matcher.GetUpdates());
+        depth = matcher.GetDepth(); confidence = matcher.GetConfidence();
+    }
+
+    _logger->Log(1, "Saving the depth and confidence maps");
+    Save(outputFolder, "depth", _frames[0]->GetId(), depth);
+    Save(outputFolder, "confidence", _frames[0]->GetId(), confidence);
+}
+
+/**
+ * Match every frame of the input folder against the frames within a sliding window around it
+ * @param outputFolder The folder that the maps are saved to
+ * @param settings The settings of each run
+ * @remarks The frames are loaded into a ring buffer as the window reaches them, and are released once it has
+ * passed, so only a wave of references, the radius on either side of it and the frames loaded ahead are held at once.
+ */
+void Engine::RunBatch(const string& outputFolder, MatchSettings& settings)
+{
+    auto inputFolder = ArgUtils::GetString(_parameters, "input_folder");
+    auto radius = ArgUtils::GetInteger(_parameters, "window_radius");
+    auto concurrency = ArgUtils::GetInteger(_parameters, "batch_concurrency");
+    auto lookahead = ArgUtils::GetInteger(_parameters, "batch_lookahead");
+
+    auto ids = GetFrameIds(inputFolder);
+    _logger->Log(1, "Matching %i frames (a radius of %i frames, %i references at a time, loading %i frames ahead)", (int)ids.size(), radius, concurrency, lookahead);
+
+    auto loader = [this, &inputFolder](int id) { auto frame = new Frame(inputFolder, id); frame->GetCache() = _cache; return frame; };
+    auto window = FrameWindow(ids, loader, BatchMatcher::GetCapacity(radius, concurrency, lookahead));
+    auto matcher = BatchMatcher(_calibration, &window, settings, radius, concurrency, lookahead);
+
+    matcher.Run([this, &outputFolder](Frame * reference, PatchMatcher * result)
+    {
+        _logger->Log(1, "Saving the maps of frame %i", reference->GetId());
+        Mat confidence = result->GetConfidence();
+        Save(outputFolder, "depth", reference->GetId(), result->GetDepth());
+        Save(outputFolder, "confidence", reference->GetId(), confidence);
+    });
+
+    _logger->Log(1, "Matched %i frames in %.1f seconds (%.2f frames per minute)", matcher.GetReferences(), matcher.GetSeconds(), matcher.GetFramesPerMinute());
+    _logger->Log(1, "Loaded %i frames for %i references and %i pixel updates", window.GetLoads(), matcher.GetReferences(), (int)matcher.GetUpdates());
+}
+
+//--------------------------------------------------
+// Parameters
+//--------------------------------------------------
+
+/**
+ * Load the settings of a PatchMatch run
+ * @return The resultant settings
+ */
+MatchSettings Engine::GetSettings()
+{
+    _logger->Log(1, "Loading the matching parameters");
+    auto minDepth = ArgUtils::GetDouble(_parameters, "min_depth");
+    auto maxDepth = ArgUtils::GetDouble(_parameters, "max_depth");
+    auto window = ArgUtils::GetInteger(_parameters, "window");
+    auto iterations = ArgUtils::GetInteger(_parameters, "iterations");
+    auto refineSteps = ArgUtils::GetInteger(_parameters, "refine_steps");
+
+    auto result = MatchSettings(minDepth, maxDepth, window, iterations, refineSteps);
+    result.GetStride() = ArgUtils::GetInteger(_parameters, "window_stride");
+    result.GetViewCount() = ArgUtils::GetInteger(_parameters, "view_count");
+    result.GetSelection() = GetSelection(ArgUtils::GetString(_parameters, "view_selection"));
+    result.GetLevels() = ArgUtils::GetInteger(_parameters, "pyramid_levels");
+    result.GetLevelIterations() = ArgUtils::GetInteger(_parameters, "level_iterations");
+    result.GetMinActive() = ArgUtils::GetDouble(_parameters, "min_active");
+    result.GetSeed() = ArgUtils::GetInteger(_parameters, "seed");
+    result.GetHalfPrecision() = ArgUtils::GetBoolean(_parameters, "half_precision");
+    return result;
+}
+
+//--------------------------------------------------
+// Fusion
+//--------------------------------------------------
+
+/**
+ * Fuse the saved depth maps of a sequence into cloud.ply
+ * @param outputFolder The folder that the depth maps were saved to (and that the cloud is saved to)
+ * @param indices The frames whose depth maps are fused, in sequence order
+ * @remarks The frames and maps are loaded one at a time and handed to the fusion, which only holds the maps
+ * within its radius, so the memory does not grow with the length of the sequence.
+ */
+void Engine::Fuse(const string& outputFolder, const vector<int>& indices)
+{
+    _logger->Log(1, "Loading the fusion parameters");
+    auto inputFolder = ArgUtils::GetString(_parameters, "input_folder");
+    auto voxelSize = ArgUtils::GetDouble(_parameters, "voxel_size");
+    auto radius = ArgUtils::GetInteger(_parameters, "fusion_radius");
+    auto depthTolerance = ArgUtils::GetDouble(_parameters, "depth_tolerance");
+    auto colourTolerance = ArgUtils::GetDouble(_parameters, "colour_tolerance");
+    auto minConsistent = ArgUtils::GetInteger(_parameters, "min_consistent");
+
+    _logger->Log(1, "Fusing %i depth maps", (int)indices.size());
+    auto voxels = VoxelHash(voxelSize);
+    auto fusion = DepthFusion(_calibration, &voxels, radius, depthTolerance, colourTolerance, minConsistent);
+
+    for (auto index : indices)
+    {
+        auto path = GetPath(outputFolder, "depth", index);
+        Mat depth = imread(path, IMREAD_UNCHANGED); if (depth.empty()) throw runtime_error("Unable to open depth map: " + path);
 
+        auto frame = Frame(inputFolder, index);
+        fusion.Add(&frame, depth);
+    }
+    fusion.Finish();
+    _logger->Log(1, "Fusion kept %i points (%i rejected) in %i voxels", (int)fusion.GetAccepted(), (int)fusion.GetRejected(), (int)voxels.GetCount());
 
+    _logger->Log(1, "Saving the point cloud");
+    voxels.Save(NVLib::FileUtils::PathCombine(outputFolder, "cloud.ply"));
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * Save a float map as <name>_<index>.tiff
+ * @param folder The folder that we are saving to
+ * @param name The name of the map
+ * @param index The index of the frame that the map belongs to
+ * @param image The map that we are saving
+ */
+void Engine::Save(const string& folder, const string& name, int index, Mat& image) 
+{
+    auto path = GetPath(folder, name, index);
+    if (!imwrite(path, image)) throw runtime_error("Unable to save: " + path);
+}
+
+/**
+ * Build the path of a map, <folder>/<name>_<index>.tiff
+ * @param folder The folder that the map is in
+ * @param name The name of the map
+ * @param index The index of the frame that the map belongs to
+ * @return The resultant path
+ */
+string Engine::GetPath(const string& folder, const string& name, int index) 
+{
+    auto fileName = stringstream(); fileName << name << "_" << setw(4) << setfill('0') << index << ".tiff";
+    return NVLib::FileUtils::PathCombine(folder, fileName.str());
+}
+
+/**
+ * Find the frames of a sequence, the image_<index>.jpg files of a folder
+ * @param folder The folder that we are searching
+ * @return The indices of the frames, in ascending order
+ */
+vector<int> Engine::GetFrameIds(const string& folder) 
+{
+    auto files = vector<string>(); NVLib::FileUtils::GetFileList(folder, files);
+
+    auto result = vector<int>();
+    for (auto& file : files)
+    {
+        auto name = file.substr(file.find_last_of("/\\") + 1);
+        if (name.size() <= 10 || name.rfind("image_", 0) != 0 || name.substr(name.size() - 4) != ".jpg") continue;
+
+        auto digits = name.substr(6, name.size() - 10);
+        if (digits.find_first_not_of("0123456789") != string::npos) continue;
+        result.push_back(NVLib::StringUtils::String2Int(digits));
+    }
+
+    if (result.empty()) throw runtime_error("No frames were found in: " + folder);
+    sort(result.begin(), result.end());
+    return result;
+}
+
+/**
+ * Convert the name of a view selection strategy into its constant
+ * @param name The name ("topk" or "sample")
+ * @return The matching SELECT_ constant
+ */
+int Engine::GetSelection(const string& name) 
+{
+    if (name == "topk") return SELECT_TOP_K;
+    if (name == "sample") return SELECT_SAMPLE;
+    throw runtime_error("Unknown view selection: " + name);
 }
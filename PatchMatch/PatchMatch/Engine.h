@@ -16,7 +16,14 @@ using namespace std;
 
 #include <PatchMatchLib/Calibration.h>
 #include <PatchMatchLib/Frame.h>
+#include <PatchMatchLib/ImageCache.h>
 #include <PatchMatchLib/ArgUtils.h>
+#include <PatchMatchLib/PatchMatcher.h>
+#include <PatchMatchLib/TiledMatcher.h>
+#include <PatchMatchLib/VoxelHash.h>
+#include <PatchMatchLib/DepthFusion.h>
+#include <PatchMatchLib/FrameWindow.h>
+#include <PatchMatchLib/BatchMatcher.h>
 
 namespace NVL_App
 {
@@ -27,12 +34,23 @@ namespace NVL_App
 		NVLib::Logger* _logger;
 
 		Calibration * _calibration;
+		ImageCache * _cache;
 		vector<Frame *> _frames;
+		bool _batchMode;
 
 	public:
 		Engine(NVLib::Logger* logger, NVLib::Parameters * parameters);
 		~Engine();
 
 		void Run();
+	private:
+		void RunSingle(const string& outputFolder, MatchSettings& settings);
+		void RunBatch(const string& outputFolder, MatchSettings& settings);
+		void Fuse(const string& outputFolder, const vector<int>& indices);
+		void Save(const string& folder, const string& name, int index, Mat& image);
+		string GetPath(const string& folder, const string& name, int index);
+		MatchSettings GetSettings();
+		vector<int> GetFrameIds(const string& folder);
+		int GetSelection(const string& name);
 	};
 }
@@ -83,3 +83,19 @@ bool ArgUtils::GetBoolean(NVLib::Parameters * parameters, const string& key)
 	auto value = parameters->Get(key);
 	return NVLib::StringUtils::String2Bool(value);
 }
+
+/**
+ * @brief Retrieve a comma separated list of integers
+ * @param parameters The parameters that we are extracting from
+ * @param key The given key value
+ * @return vector<int> The integers that were listed (empty for an empty value)
+ */
+vector<int> ArgUtils::GetIntegers(NVLib::Parameters * parameters, const string& key)
+{
+	if (!parameters->Contains(key)) throw runtime_error("The parameters does not contain the required value: " + key);
+	auto parts = vector<string>(); NVLib::StringUtils::Split(parameters->Get(key), ',', parts);
+
+	auto result = vector<int>();
+	for (auto& part : parts) if (!part.empty()) result.push_back(NVLib::StringUtils::String2Int(part));
+	return result;
+}
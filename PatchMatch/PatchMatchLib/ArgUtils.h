@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <vector>
 #include <iostream>
 using namespace std;
 
@@ -26,5 +27,6 @@ namespace NVL_App
 		static int GetInteger(NVLib::Parameters * parameters, const string& key);
 		static double GetDouble(NVLib::Parameters * parameters, const string& key);
 		static bool GetBoolean(NVLib::Parameters * parameters, const string& key);
+		static vector<int> GetIntegers(NVLib::Parameters * parameters, const string& key);
 	};
 }
@@ -0,0 +1,175 @@
+//--------------------------------------------------
+// Implementation of class BatchMatcher
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "BatchMatcher.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define MAX_SOURCES 32
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param calibration The calibration of the camera (the frames are assumed to be undistorted)
+ * @param window The frames of the sequence (it must hold at least GetCapacity(radius, concurrency, lookahead) frames)
+ * @param settings The settings of each reference's run
+ * @param radius The number of frames on either side of a reference that are used as its sources (at most 16)
+ * @param concurrency The number of references that are matched at the same time
+ * @param lookahead The number of frames past the current wave's sources that are loaded while it is matched (at
+ * least the concurrency, so that the next wave is always loaded before it starts)
+ * @remarks The thread budget of the references starts at the size of the OpenCV pool (see GetThreads).
+ */
+BatchMatcher::BatchMatcher(Calibration * calibration, FrameWindow * window, MatchSettings& settings, int radius, int concurrency, int lookahead) :
+	_calibration(calibration), _window(window), _settings(settings), _radius(radius), _concurrency(max(concurrency, 1)), _lookahead(max(lookahead, _concurrency)),
+	_threads(getNumThreads()), _references(0), _updates(0), _seconds(0)
+{
+	if (radius <= 0 || 2 * radius > MAX_SOURCES) throw runtime_error("The window radius must be between 1 and 16");
+	if (window->GetCapacity() < GetCapacity(radius, _concurrency, _lookahead)) throw runtime_error("The frame window is too small for the radius, concurrency and lookahead");
+	if (window->GetIds().size() < 2) throw runtime_error("A sequence needs at least two frames");
+}
+
+//--------------------------------------------------
+// Execution
+//--------------------------------------------------
+
+/**
+ * @brief Match every frame of the sequence against its neighbours
+ * @param sink Called with each reference and its finished matcher, in sequence order (and never two at once)
+ * @remarks The references are matched in waves of `concurrency` consecutive frames. The matchers of a wave run side
+ * by side, each on its own share of the thread budget, so no core waits on a single reference's loop. While a wave
+ * is matched, a helper thread hands the previous wave to the sink and moves the window forward to load the frames
+ * ahead, so the loading and saving overlap the matching. The window only releases frames before the current
+ * wave's sources, after the previous wave has been handed over, so nothing that is in use is freed. Every pixel
+ * draws its own random numbers, so the depths do not depend on the concurrency. The first error (in sequence
+ * order) is rethrown once the wave and the helper have both stopped.
+ */
+void BatchMatcher::Run(const Sink& sink)
+{
+	auto count = (int)_window->GetIds().size(); _references = 0; _updates = 0;
+	auto start = chrono::steady_clock::now();
+
+	_window->Advance(0, _concurrency + _radius);
+
+	auto finished = Wave(); auto previous = 0;
+	for (auto first = 0; first < count; first += _concurrency)
+	{
+		auto end = min(first + _concurrency, count);
+		auto settings = _settings; settings.GetThreads() = max(1, _threads / (end - first));
+
+		auto wave = Wave();
+		for (auto position = first; position < end; position++)
+		{
+			auto sources = GetSources(position);
+			wave.push_back(unique_ptr<PatchMatcher>(new PatchMatcher(_calibration, _window->Get(position), sources, settings)));
+		}
+
+		auto error = exception_ptr(); auto failure = exception_ptr();
+		auto helper = Prepare(first, end, previous, move(finished), sink, error);
+		try { RunWave(wave); } catch (...) { failure = current_exception(); }
+		helper.join();
+		if (error) rethrow_exception(error);
+		if (failure) rethrow_exception(failure);
+
+		for (auto& matcher : wave) { _updates += matcher->GetUpdates(); _references++; }
+		finished = move(wave); previous = first;
+	}
+
+	for (auto i = 0; i < (int)finished.size(); i++) sink(_window->Get(previous + i), finished[i].get());
+
+	_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Retrieve the throughput of the last run
+ * @return double The number of references matched per minute of wall time (including loading and the sink)
+ */
+double BatchMatcher::GetFramesPerMinute()
+{
+	return _seconds <= 0 ? 0 : _references * 60.0 / _seconds;
+}
+
+/**
+ * @brief Find the number of frames that a window must hold for a batch run
+ * @param radius The window radius of a reference
+ * @param concurrency The number of references that are matched at the same time
+ * @param lookahead The number of frames that are loaded ahead of the current wave's sources
+ * @return int A wave of references, the radius on either side of it, and the frames that are loaded ahead
+ */
+int BatchMatcher::GetCapacity(int radius, int concurrency, int lookahead)
+{
+	concurrency = max(concurrency, 1);
+	return concurrency + 2 * radius + max(lookahead, concurrency);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Collect the sources of a reference, the frames within the radius on either side of it
+ * @param position The position of the reference in the sequence
+ * @return vector<Frame *> The sources (fewer at the ends of the sequence)
+ */
+vector<Frame *> BatchMatcher::GetSources(int position)
+{
+	auto result = vector<Frame *>(); auto count = (int)_window->GetIds().size();
+
+	for (auto neighbour = max(position - _radius, 0); neighbour <= min(position + _radius, count - 1); neighbour++)
+	{
+		if (neighbour != position) result.push_back(_window->Get(neighbour));
+	}
+
+	return result;
+}
+
+/**
+ * @brief Run the matchers of a wave side by side
+ * @param wave The matchers (the calling thread runs the first)
+ * @remarks The first error of a matcher is rethrown once every matcher of the wave has stopped.
+ */
+void BatchMatcher::RunWave(Wave& wave)
+{
+	auto errors = vector<exception_ptr>(wave.size()); auto workers = vector<thread>();
+	auto run = [&](int index) { try { wave[index]->Run(); } catch (...) { errors[index] = current_exception(); } };
+
+	for (auto index = 1; index < (int)wave.size(); index++) workers.push_back(thread(run, index));
+	run(0);
+	for (auto& worker : workers) worker.join();
+
+	for (auto& error : errors) if (error) rethrow_exception(error);
+}
+
+/**
+ * @brief Start the work that runs alongside the matching of a wave
+ * @param first The position of the first reference of the wave that is being matched
+ * @param end The position after the last reference of the wave
+ * @param previous The position of the first reference of the previous wave
+ * @param finished The finished matchers of the previous wave (empty for the first wave), which the helper owns
+ * @param sink The sink that the previous wave is handed to
+ * @param error Set to the exception that the helper threw, if any
+ * @return thread The helper thread, which the caller joins once its own matching is done
+ * @remarks The finished matchers are freed when the helper ends, whether or not the sink throws.
+ */
+thread BatchMatcher::Prepare(int first, int end, int previous, Wave finished, const Sink& sink, exception_ptr& error)
+{
+	return thread([this, first, end, previous, finished = move(finished), &sink, &error]()
+	{
+		try
+		{
+			for (auto i = 0; i < (int)finished.size(); i++) sink(_window->Get(previous + i), finished[i].get());
+			_window->Advance(first - _radius, end + _radius + _lookahead);
+		}
+		catch (...) { error = current_exception(); }
+	});
+}
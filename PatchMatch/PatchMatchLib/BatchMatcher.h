@@ -0,0 +1,67 @@
+//--------------------------------------------------
+// Engine: Runs PatchMatch over a whole sequence, with every frame as a reference and its neighbours as sources
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include <memory>
+#include <exception>
+#include <vector>
+#include <iostream>
+#include <functional>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Calibration.h"
+#include "Frame.h"
+#include "FrameWindow.h"
+#include "MatchSettings.h"
+#include "PatchMatcher.h"
+
+namespace NVL_App
+{
+	class BatchMatcher
+	{
+	public:
+		typedef function<void(Frame * reference, PatchMatcher * matcher)> Sink;
+		typedef vector<unique_ptr<PatchMatcher>> Wave;
+	private:
+		Calibration * _calibration;
+		FrameWindow * _window;
+		MatchSettings _settings;
+		int _radius;
+		int _concurrency;
+		int _lookahead;
+		int _threads;
+		int _references;
+		size_t _updates;
+		double _seconds;
+	public:
+		BatchMatcher(Calibration * calibration, FrameWindow * window, MatchSettings& settings, int radius, int concurrency, int lookahead);
+
+		void Run(const Sink& sink);
+
+		double GetFramesPerMinute();
+		static int GetCapacity(int radius, int concurrency, int lookahead);
+
+		inline int& GetRadius() { return _radius; }
+		inline int& GetConcurrency() { return _concurrency; }
+		inline int& GetLookahead() { return _lookahead; }
+		inline int& GetThreads() { return _threads; }
+		inline int& GetReferences() { return _references; }
+		inline size_t& GetUpdates() { return _updates; }
+		inline double& GetSeconds() { return _seconds; }
+	private:
+		vector<Frame *> GetSources(int position);
+		void RunWave(Wave& wave);
+		thread Prepare(int first, int end, int previous, Wave finished, const Sink& sink, exception_ptr& error);
+	};
+}
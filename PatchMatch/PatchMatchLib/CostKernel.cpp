@@ -0,0 +1,350 @@
+//--------------------------------------------------
+// Implementation of class CostKernel
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "CostKernel.h"
+using namespace NVL_App;
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define KERNEL_X86
+#endif
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param pair The images that are being matched
+ * @param window The half-width of the matching window
+ * @param stride The distance between the samples of the window (1 samples every pixel)
+ */
+CostKernel::CostKernel(ViewPair * pair, int window, int stride) : _pair(pair), _window(window), _stride(max(stride, 1)), _vectorized(true)
+{
+	_statistics = BuildStatistics(pair->GetReference(), _window, _stride);
+}
+
+/**
+ * @brief Shared Constructor
+ * @param pair The images that are being matched
+ * @param window The half-width of the matching window
+ * @param stride The distance between the samples of the window (1 samples every pixel)
+ * @param statistics The window statistics of the reference (from BuildStatistics), shared by the kernels of every source
+ */
+CostKernel::CostKernel(ViewPair * pair, int window, int stride, Mat& statistics) : _pair(pair), _window(window), _stride(max(stride, 1)), _vectorized(true), _statistics(statistics)
+{
+	if (statistics.size() != pair->GetReference().size() || statistics.type() != CV_32FC2) throw runtime_error("The window statistics do not match the reference");
+}
+
+//--------------------------------------------------
+// Statistics
+//--------------------------------------------------
+
+/**
+ * @brief Find the mean and the energy (root of the summed squared deviation) of the reference window at every pixel
+ * @param reference The reference image (CV_32F)
+ * @param window The half-width of the matching window
+ * @param stride The distance between the samples of the window
+ * @return Mat The resultant CV_32FC2 image (mean, energy)
+ * @remarks A strided window only visits pixels of one phase (x mod stride, y mod stride), so each phase is
+ * decimated into its own image and summed with an integral image. Each window is then four lookups.
+ */
+Mat CostKernel::BuildStatistics(Mat& reference, int window, int stride)
+{
+	stride = max(stride, 1); auto radius = window / stride;
+	auto result = Mat(reference.size(), CV_32FC2);
+
+	for (auto phaseY = 0; phaseY < min(stride, reference.rows); phaseY++)
+	{
+		for (auto phaseX = 0; phaseX < min(stride, reference.cols); phaseX++)
+		{
+			auto width = (reference.cols - phaseX + stride - 1) / stride; auto height = (reference.rows - phaseY + stride - 1) / stride;
+
+			Mat phase = Mat(height, width, CV_32FC1);
+			for (auto row = 0; row < height; row++)
+			{
+				auto source = reference.ptr<float>(phaseY + row * stride); auto target = phase.ptr<float>(row);
+				for (auto column = 0; column < width; column++) target[column] = source[phaseX + column * stride];
+			}
+
+			Mat sum, squareSum; integral(phase, sum, squareSum, CV_64F, CV_64F);
+
+			for (auto row = 0; row < height; row++)
+			{
+				auto top = row - min(radius, row); auto bottom = row + min(radius, height - 1 - row) + 1;
+				auto statistics = result.ptr<Vec2f>(phaseY + row * stride);
+
+				for (auto column = 0; column < width; column++)
+				{
+					auto left = column - min(radius, column); auto right = column + min(radius, width - 1 - column) + 1;
+					auto count = (double)(bottom - top) * (right - left);
+
+					auto total = sum.at<double>(bottom, right) - sum.at<double>(top, right) - sum.at<double>(bottom, left) + sum.at<double>(top, left);
+					auto squares = squareSum.at<double>(bottom, right) - squareSum.at<double>(top, right) - squareSum.at<double>(bottom, left) + squareSum.at<double>(top, left);
+
+					statistics[phaseX + column * stride] = Vec2f((float)(total / count), (float)sqrt(max(0.0, squares - total * total / count)));
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Find the samples of the window at a pixel (clipped to the image)
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @return Vec4i The first column, last column, first row and last row that are sampled
+ */
+Vec4i CostKernel::GetBounds(int x, int y)
+{
+	auto& reference = _pair->GetReference(); auto radius = _window / _stride;
+
+	auto left = x - _stride * min(radius, x / _stride); auto right = x + _stride * min(radius, (reference.cols - 1 - x) / _stride);
+	auto top = y - _stride * min(radius, y / _stride); auto bottom = y + _stride * min(radius, (reference.rows - 1 - y) / _stride);
+
+	return Vec4i(left, right, top, bottom);
+}
+
+//--------------------------------------------------
+// Scoring
+//--------------------------------------------------
+
+/**
+ * @brief Find the cost of a plane hypothesis at a reference pixel
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param depth The depth of the hypothesis
+ * @param normal The normal of the hypothesis
+ * @return float One minus the ZNCC of the window and its warp into the source (PMATCH_MAX_COST if it is not visible)
+ */
+float CostKernel::GetCost(int x, int y, float depth, const Vec3f& normal)
+{
+	auto result = PMATCH_MAX_COST;
+	GetCosts(x, y, 1, &depth, &normal, &result);
+	return result;
+}
+
+/**
+ * @brief Find the costs of several plane hypotheses at the same reference pixel
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param count The number of hypotheses
+ * @param depths The depth of each hypothesis
+ * @param normals The normal of each hypothesis
+ * @param costs The resultant costs
+ * @remarks The hypotheses share the reference window, so the AVX2 path gives each one a lane and walks the
+ * window once for every group of eight.
+ */
+void CostKernel::GetCosts(int x, int y, int count, const float * depths, const Vec3f * normals, float * costs)
+{
+	float homographies[KERNEL_LANES * 9]; bool valid[KERNEL_LANES];
+
+	for (auto first = 0; first < count; first += KERNEL_LANES)
+	{
+		auto lanes = min(KERNEL_LANES, count - first);
+		for (auto lane = 0; lane < lanes; lane++) valid[lane] = GetHomography(x, y, depths[first + lane], normals[first + lane], &homographies[lane * 9]);
+
+		if (_vectorized && HasAvx2()) ScoreAvx2(x, y, lanes, homographies, valid, &costs[first]);
+		else ScorePortable(x, y, lanes, homographies, valid, &costs[first]);
+	}
+}
+
+/**
+ * @brief Build the homography of a hypothesis
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param depth The depth of the hypothesis
+ * @param normal The normal of the hypothesis
+ * @param homography The resultant homography (9 values, row major)
+ * @return true If the plane faces the camera
+ * @return false If the plane faces away from the camera (or passes through it)
+ */
+bool CostKernel::GetHomography(int x, int y, float depth, const Vec3f& normal, float * homography)
+{
+	auto point = _pair->GetRay(x, y) * (double)depth;
+	auto normal64 = Vec3d(normal[0], normal[1], normal[2]);
+	if (depth <= 0 || normal64.dot(point) >= 0) return false;
+
+	auto result = _pair->GetHomography(point, normal64);
+	for (auto i = 0; i < 9; i++) homography[i] = (float)result(i / 3, i % 3);
+	return true;
+}
+
+/**
+ * @brief Convert the sums of a window into a cost
+ * @param count The number of samples
+ * @param sumS The sum of the (centred) source samples
+ * @param sumSS The sum of the squared (centred) source samples
+ * @param sumRS The sum of the products of the centred reference and source samples
+ * @param energy The energy of the reference window
+ * @return float The resultant cost
+ */
+float CostKernel::GetZncc(int count, double sumS, double sumSS, double sumRS, float energy)
+{
+	auto variance = sumSS - sumS * sumS / count;
+	if (energy * (double)energy < 1e-6 * count || variance < 1e-6 * count) return PMATCH_MAX_COST;
+
+	auto zncc = sumRS / (energy * sqrt(variance));
+	return (float)max(0.0, min((double)PMATCH_MAX_COST, 1.0 - zncc));
+}
+
+/**
+ * @brief Score the hypotheses one at a time (the portable path)
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param count The number of hypotheses (at most KERNEL_LANES)
+ * @param homographies The homography of each hypothesis
+ * @param valid Whether each hypothesis faces the camera
+ * @param costs The resultant costs
+ * @remarks Both images are centred on the reference mean, which keeps the sums small and the ZNCC the same.
+ */
+void CostKernel::ScorePortable(int x, int y, int count, const float * homographies, const bool * valid, float * costs)
+{
+	auto& reference = _pair->GetReference(); auto& source = _pair->GetSource();
+	auto bounds = GetBounds(x, y); auto& statistics = _statistics.at<Vec2f>(y, x); auto mean = statistics[0]; auto energy = statistics[1];
+	auto maxX = (float)(source.cols - 1); auto maxY = (float)(source.rows - 1);
+
+	for (auto lane = 0; lane < count; lane++)
+	{
+		costs[lane] = PMATCH_MAX_COST; if (!valid[lane]) continue;
+
+		auto h = &homographies[lane * 9]; auto sumS = 0.0, sumSS = 0.0, sumRS = 0.0; auto samples = 0; auto visible = true;
+
+		for (auto row = bounds[2]; row <= bounds[3] && visible; row += _stride)
+		{
+			auto referenceRow = reference.ptr<float>(row);
+			for (auto column = bounds[0]; column <= bounds[1]; column += _stride)
+			{
+				auto px = h[0] * column + h[1] * row + h[2]; auto py = h[3] * column + h[4] * row + h[5]; auto pz = h[6] * column + h[7] * row + h[8];
+				if (pz <= 0) { visible = false; break; }
+
+				auto sx = px / pz; auto sy = py / pz;
+				if (!(sx >= 0 && sy >= 0 && sx <= maxX && sy <= maxY)) { visible = false; break; }
+
+				auto x0 = min((int)sx, source.cols - 2); auto y0 = min((int)sy, source.rows - 2);
+				auto ax = sx - x0; auto ay = sy - y0;
+				auto top = source.ptr<float>(y0) + x0; auto bottom = source.ptr<float>(y0 + 1) + x0;
+				auto value = (1 - ay) * ((1 - ax) * top[0] + ax * top[1]) + ay * ((1 - ax) * bottom[0] + ax * bottom[1]) - mean;
+				auto original = referenceRow[column] - mean;
+
+				sumS += value; sumSS += value * value; sumRS += original * value; samples++;
+			}
+		}
+
+		if (visible) costs[lane] = GetZncc(samples, sumS, sumSS, sumRS, energy);
+	}
+}
+
+//--------------------------------------------------
+// AVX2
+//--------------------------------------------------
+
+/**
+ * @brief Determine whether the processor supports the AVX2 path
+ * @return true If AVX2 and FMA are available
+ */
+bool CostKernel::HasAvx2()
+{
+#ifdef KERNEL_X86
+	static auto supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+	return supported;
+#else
+	return false;
+#endif
+}
+
+#ifdef KERNEL_X86
+
+/**
+ * @brief Score up to eight hypotheses together, one per lane (the AVX2 path)
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param count The number of hypotheses (at most KERNEL_LANES)
+ * @param homographies The homography of each hypothesis
+ * @param valid Whether each hypothesis faces the camera
+ * @param costs The resultant costs
+ * @remarks Sample coordinates are clamped before the gathers, so every load stays inside the source and lanes
+ * that leave the image are only dropped through their mask.
+ */
+__attribute__((target("avx2,fma"))) void CostKernel::ScoreAvx2(int x, int y, int count, const float * homographies, const bool * valid, float * costs)
+{
+	auto& reference = _pair->GetReference(); auto& source = _pair->GetSource();
+	auto bounds = GetBounds(x, y); auto& statistics = _statistics.at<Vec2f>(y, x); auto mean = statistics[0]; auto energy = statistics[1];
+
+	__m256 h[9]; alignas(32) float lanes[KERNEL_LANES]; alignas(32) int laneMask[KERNEL_LANES];
+	for (auto i = 0; i < 9; i++)
+	{
+		for (auto lane = 0; lane < KERNEL_LANES; lane++) lanes[lane] = homographies[min(lane, count - 1) * 9 + i];
+		h[i] = _mm256_load_ps(lanes);
+	}
+	for (auto lane = 0; lane < KERNEL_LANES; lane++) laneMask[lane] = lane < count && valid[lane] ? -1 : 0;
+	auto visible = _mm256_castsi256_ps(_mm256_load_si256((const __m256i *)laneMask));
+
+	auto data = source.ptr<float>(0); auto step = (int)(source.step / sizeof(float));
+	auto zero = _mm256_setzero_ps(); auto one = _mm256_set1_ps(1.0f);
+	auto maxX = _mm256_set1_ps((float)(source.cols - 1)); auto maxY = _mm256_set1_ps((float)(source.rows - 1));
+	auto lastX = _mm256_set1_ps((float)(source.cols - 2)); auto lastY = _mm256_set1_ps((float)(source.rows - 2));
+	auto stepVector = _mm256_set1_epi32(step); auto centre = _mm256_set1_ps(mean);
+	auto sumS = _mm256_setzero_ps(), sumSS = _mm256_setzero_ps(), sumRS = _mm256_setzero_ps();
+	auto samples = 0;
+
+	for (auto row = bounds[2]; row <= bounds[3]; row += _stride)
+	{
+		auto referenceRow = reference.ptr<float>(row); auto v = _mm256_set1_ps((float)row);
+		auto rowX = _mm256_fmadd_ps(h[1], v, h[2]); auto rowY = _mm256_fmadd_ps(h[4], v, h[5]); auto rowZ = _mm256_fmadd_ps(h[7], v, h[8]);
+
+		for (auto column = bounds[0]; column <= bounds[1]; column += _stride)
+		{
+			auto u = _mm256_set1_ps((float)column);
+			auto px = _mm256_fmadd_ps(h[0], u, rowX); auto py = _mm256_fmadd_ps(h[3], u, rowY); auto pz = _mm256_fmadd_ps(h[6], u, rowZ);
+			visible = _mm256_and_ps(visible, _mm256_cmp_ps(pz, zero, _CMP_GT_OQ));
+
+			auto inverse = _mm256_div_ps(one, pz);
+			auto sx = _mm256_mul_ps(px, inverse); auto sy = _mm256_mul_ps(py, inverse);
+			visible = _mm256_and_ps(visible, _mm256_and_ps(_mm256_cmp_ps(sx, zero, _CMP_GE_OQ), _mm256_cmp_ps(sx, maxX, _CMP_LE_OQ)));
+			visible = _mm256_and_ps(visible, _mm256_and_ps(_mm256_cmp_ps(sy, zero, _CMP_GE_OQ), _mm256_cmp_ps(sy, maxY, _CMP_LE_OQ)));
+
+			sx = _mm256_min_ps(_mm256_max_ps(sx, zero), maxX); sy = _mm256_min_ps(_mm256_max_ps(sy, zero), maxY);
+			auto x0 = _mm256_min_ps(_mm256_floor_ps(sx), lastX); auto y0 = _mm256_min_ps(_mm256_floor_ps(sy), lastY);
+			auto ax = _mm256_sub_ps(sx, x0); auto ay = _mm256_sub_ps(sy, y0);
+
+			auto index = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_cvttps_epi32(y0), stepVector), _mm256_cvttps_epi32(x0));
+			auto a = _mm256_i32gather_ps(data, index, 4); auto b = _mm256_i32gather_ps(data + 1, index, 4);
+			auto c = _mm256_i32gather_ps(data + step, index, 4); auto d = _mm256_i32gather_ps(data + step + 1, index, 4);
+
+			auto top = _mm256_fmadd_ps(ax, _mm256_sub_ps(b, a), a); auto bottom = _mm256_fmadd_ps(ax, _mm256_sub_ps(d, c), c);
+			auto value = _mm256_sub_ps(_mm256_fmadd_ps(ay, _mm256_sub_ps(bottom, top), top), centre);
+			auto original = _mm256_set1_ps(referenceRow[column] - mean);
+
+			sumS = _mm256_add_ps(sumS, value); sumSS = _mm256_fmadd_ps(value, value, sumSS); sumRS = _mm256_fmadd_ps(original, value, sumRS);
+			samples++;
+		}
+	}
+
+	alignas(32) float s[KERNEL_LANES], ss[KERNEL_LANES], rs[KERNEL_LANES], mask[KERNEL_LANES];
+	_mm256_store_ps(s, sumS); _mm256_store_ps(ss, sumSS); _mm256_store_ps(rs, sumRS); _mm256_store_ps(mask, visible);
+
+	for (auto lane = 0; lane < count; lane++)
+	{
+		costs[lane] = laneMask[lane] && ((int *)mask)[lane] ? GetZncc(samples, s[lane], ss[lane], rs[lane], energy) : PMATCH_MAX_COST;
+	}
+}
+
+#else
+
+/**
+ * @brief Score the hypotheses without AVX2 (only reached on processors that do not have it)
+ */
+void CostKernel::ScoreAvx2(int x, int y, int count, const float * homographies, const bool * valid, float * costs)
+{
+	ScorePortable(x, y, count, homographies, valid, costs);
+}
+
+#endif
@@ -0,0 +1,58 @@
+//--------------------------------------------------
+// Kernel: Scores plane hypotheses with a strided ZNCC window (AVX2 with a portable fallback)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "ViewPair.h"
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define PMATCH_MAX_COST 2.0f
+#define KERNEL_LANES 8
+
+namespace NVL_App
+{
+	class CostKernel
+	{
+	private:
+		ViewPair * _pair;
+		int _window;
+		int _stride;
+		bool _vectorized;
+		Mat _statistics;
+	public:
+		CostKernel(ViewPair * pair, int window, int stride);
+		CostKernel(ViewPair * pair, int window, int stride, Mat& statistics);
+
+		float GetCost(int x, int y, float depth, const Vec3f& normal);
+		void GetCosts(int x, int y, int count, const float * depths, const Vec3f * normals, float * costs);
+
+		static Mat BuildStatistics(Mat& reference, int window, int stride);
+		static bool HasAvx2();
+
+		inline int& GetWindow() { return _window; }
+		inline int& GetStride() { return _stride; }
+		inline bool& GetVectorized() { return _vectorized; }
+		inline Mat& GetStatistics() { return _statistics; }
+	private:
+		Vec4i GetBounds(int x, int y);
+		bool GetHomography(int x, int y, float depth, const Vec3f& normal, float * homography);
+		void ScorePortable(int x, int y, int count, const float * homographies, const bool * valid, float * costs);
+		void ScoreAvx2(int x, int y, int count, const float * homographies, const bool * valid, float * costs);
+		float GetZncc(int count, double sumS, double sumSS, double sumRS, float energy);
+	};
+}
@@ -0,0 +1,101 @@
+//--------------------------------------------------
+// Utility: A counter-based random number generator (Philox4x32-10) keyed by a seed, a stream and a position
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define PHILOX_ROUNDS 10
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+namespace NVL_App
+{
+	class CounterRng
+	{
+	private:
+		uint32_t _key[2];
+		uint32_t _counter[4];
+		uint32_t _block[4];
+		int _used;
+	public:
+		/**
+		 * @brief Main Constructor
+		 * @param seed The seed of the run (the key of the generator)
+		 * @param stream What the numbers are for (for example the pass of an iteration)
+		 * @param position Where the numbers are used (for example the index of a pixel)
+		 * @remarks The numbers only depend on the three values, so a pixel draws the same numbers whichever thread
+		 * visits it and in whatever order. Each (stream, position) pair has 2^32 blocks of four numbers.
+		 */
+		CounterRng(uint64_t seed, uint32_t stream, uint64_t position) : _used(4)
+		{
+			_key[0] = (uint32_t)seed; _key[1] = (uint32_t)(seed >> 32);
+			_counter[0] = 0; _counter[1] = (uint32_t)position; _counter[2] = (uint32_t)(position >> 32); _counter[3] = stream;
+		}
+
+		/**
+		 * @brief Draw the next 32 random bits
+		 * @return uint32_t The resultant bits
+		 */
+		inline uint32_t Next()
+		{
+			if (_used == 4) { Generate(); _counter[0]++; _used = 0; }
+			return _block[_used++];
+		}
+
+		/**
+		 * @brief Draw a float that is uniformly distributed in [low, high)
+		 * @param low The lower bound
+		 * @param high The upper bound
+		 * @return float The resultant value
+		 */
+		inline float Uniform(float low, float high)
+		{
+			return low + (high - low) * ((Next() >> 8) * (1.0f / 16777216.0f));
+		}
+
+		/**
+		 * @brief Draw an integer that is uniformly distributed in [low, high)
+		 * @param low The lower bound
+		 * @param high The upper bound
+		 * @return int The resultant value
+		 */
+		inline int Uniform(int low, int high)
+		{
+			return low + (int)(((uint64_t)Next() * (uint64_t)(high - low)) >> 32);
+		}
+	private:
+		/**
+		 * @brief Encrypt the counter with the key, giving the next block of four numbers
+		 */
+		inline void Generate()
+		{
+			uint32_t c0 = _counter[0], c1 = _counter[1], c2 = _counter[2], c3 = _counter[3];
+			uint32_t k0 = _key[0], k1 = _key[1];
+
+			for (auto round = 0; round < PHILOX_ROUNDS; round++)
+			{
+				if (round > 0) { k0 += PHILOX_W0; k1 += PHILOX_W1; }
+
+				auto product0 = (uint64_t)PHILOX_M0 * c0; auto product1 = (uint64_t)PHILOX_M1 * c2;
+				auto next0 = (uint32_t)(product1 >> 32) ^ c1 ^ k0; auto next2 = (uint32_t)(product0 >> 32) ^ c3 ^ k1;
+				c0 = next0; c1 = (uint32_t)product1; c2 = next2; c3 = (uint32_t)product0;
+			}
+
+			_block[0] = c0; _block[1] = c1; _block[2] = c2; _block[3] = c3;
+		}
+	};
+}
@@ -0,0 +1,177 @@
+//--------------------------------------------------
+// Implementation of class DepthFusion
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "DepthFusion.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param calibration The calibration of the camera (the frames are assumed to be undistorted)
+ * @param voxels The voxel hash that the consistent points are merged into
+ * @param radius The number of frames on either side of a frame that it is checked against
+ * @param depthTolerance The largest relative difference between a projected depth and a neighbour's depth
+ * @param colourTolerance The largest intensity difference between a pixel and its match (0 turns the check off)
+ * @param minConsistent The number of neighbours that must agree with a pixel for it to be kept
+ */
+DepthFusion::DepthFusion(Calibration * calibration, VoxelHash * voxels, int radius, double depthTolerance, double colourTolerance, int minConsistent) :
+	_voxels(voxels), _radius(max(radius, 0)), _depthTolerance(depthTolerance), _colourTolerance(colourTolerance), _minConsistent(minConsistent), _added(0), _fused(0), _accepted(0), _rejected(0)
+{
+	Mat camera; calibration->GetCamera().convertTo(camera, CV_64F);
+	_camera = Matx33d(camera.at<double>(0, 0), camera.at<double>(0, 1), camera.at<double>(0, 2), camera.at<double>(1, 0), camera.at<double>(1, 1), camera.at<double>(1, 2), camera.at<double>(2, 0), camera.at<double>(2, 1), camera.at<double>(2, 2));
+	_cameraInverse = _camera.inv();
+}
+
+/**
+ * @brief Main Terminator
+ */
+DepthFusion::~DepthFusion()
+{
+	for (auto view : _window) delete view;
+}
+
+//--------------------------------------------------
+// Streaming
+//--------------------------------------------------
+
+/**
+ * @brief Add the next depth map of the sequence
+ * @param frame The frame that the depth map belongs to (only its image and pose are kept, so it may be released)
+ * @param depth The CV_32F depth map (0 where there is no depth)
+ * @remarks A map is fused as soon as the maps that follow it within the radius have arrived, and dropped once the
+ * maps within the radius after it are fused. At most 2 * radius + 1 maps are held, whatever the sequence length.
+ */
+void DepthFusion::Add(Frame * frame, Mat& depth)
+{
+	if (depth.size() != frame->GetSize() || depth.type() != CV_32FC1) throw runtime_error("The depth map must be a CV_32F map the size of its frame");
+
+	auto view = new View();
+	view->id = frame->GetId(); view->image = frame->GetImage(); view->gray = frame->GetGray(); view->depth = depth;
+
+	Mat pose; frame->GetPose().convertTo(pose, CV_64F);
+	view->rotation = Matx33d(pose.at<double>(0, 0), pose.at<double>(0, 1), pose.at<double>(0, 2), pose.at<double>(1, 0), pose.at<double>(1, 1), pose.at<double>(1, 2), pose.at<double>(2, 0), pose.at<double>(2, 1), pose.at<double>(2, 2));
+	view->translation = Vec3d(pose.at<double>(0, 3), pose.at<double>(1, 3), pose.at<double>(2, 3));
+
+	_window.push_back(view); _added++;
+
+	while (_fused < _added - _radius) { Fuse(_fused); _fused++; }
+	Trim();
+}
+
+/**
+ * @brief Fuse the maps that are still waiting for neighbours and release the window (at the end of the sequence)
+ */
+void DepthFusion::Finish()
+{
+	while (_fused < _added) { Fuse(_fused); _fused++; }
+
+	for (auto view : _window) delete view;
+	_window.clear();
+}
+
+/**
+ * @brief Retrieve the number of maps that are currently held
+ * @return int The resultant count
+ */
+int DepthFusion::GetHeld()
+{
+	return (int)_window.size();
+}
+
+//--------------------------------------------------
+// Fusion
+//--------------------------------------------------
+
+/**
+ * @brief Fuse one map against the maps within the radius of it
+ * @param index The position of the map in the sequence
+ * @remarks Each pixel is back-projected into the world and checked against every neighbour. The pixels that enough
+ * neighbours agree with are merged as the mean of the point and its matches, so the neighbours also refine it.
+ */
+void DepthFusion::Fuse(int index)
+{
+	auto first = _added - (int)_window.size();
+	auto view = _window[index - first];
+
+	auto neighbours = vector<View *>();
+	for (auto i = max(index - _radius, first); i <= min(index + _radius, _added - 1); i++) if (i != index) neighbours.push_back(_window[i - first]);
+
+	Matx33d rotation = view->rotation.t(); Vec3d origin = rotation * view->translation;
+	auto accepted = vector<size_t>(view->depth.rows, 0); auto candidates = vector<size_t>(view->depth.rows, 0);
+
+	parallel_for_(Range(0, view->depth.rows), [&](const Range& range)
+	{
+		vector<Vec3d> points; vector<Vec3b> colours;
+
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto depths = view->depth.ptr<float>(row); auto intensities = view->gray.ptr<float>(row);
+			for (auto column = 0; column < view->depth.cols; column++)
+			{
+				if (depths[column] <= 0) continue;
+				candidates[row]++;
+
+				Vec3d point = rotation * (_cameraInverse * Vec3d(column, row, 1.0) * (double)depths[column]) - origin;
+
+				auto consistent = 0; Vec3d sum = point; Vec3d match;
+				for (auto neighbour : neighbours)
+				{
+					if (!Check(view, neighbour, point, intensities[column], match)) continue;
+					consistent++; sum += match;
+				}
+				if (consistent < _minConsistent) continue;
+
+				auto colour = view->image.channels() == 3 ? view->image.at<Vec3b>(row, column) : Vec3b::all(view->image.at<uchar>(row, column));
+				points.push_back(sum * (1.0 / (consistent + 1))); colours.push_back(colour);
+				accepted[row]++;
+			}
+		}
+
+		_voxels->Add(points, colours);
+	});
+
+	for (auto row = 0; row < view->depth.rows; row++) { _accepted += accepted[row]; _rejected += candidates[row] - accepted[row]; }
+}
+
+/**
+ * @brief Check a point against a neighbouring map
+ * @param view The map that the point came from
+ * @param neighbour The neighbouring map
+ * @param point The point (in world coordinates)
+ * @param intensity The intensity of the point's pixel
+ * @param match The resultant point that the neighbour has where the point projects (in world coordinates)
+ * @return true If the neighbour agrees with the point, in depth and (when turned on) in intensity
+ */
+bool DepthFusion::Check(View * view, View * neighbour, const Vec3d& point, float intensity, Vec3d& match)
+{
+	Vec3d local = neighbour->rotation * point + neighbour->translation;
+	if (local[2] <= 0) return false;
+
+	Vec3d pixel = _camera * local;
+	auto u = (int)round(pixel[0] / pixel[2]); auto v = (int)round(pixel[1] / pixel[2]);
+	if (u < 0 || v < 0 || u >= neighbour->depth.cols || v >= neighbour->depth.rows) return false;
+
+	auto depth = (double)neighbour->depth.at<float>(v, u);
+	if (depth <= 0 || fabs(depth - local[2]) > _depthTolerance * local[2]) return false;
+	if (_colourTolerance > 0 && fabs(neighbour->gray.at<float>(v, u) - intensity) > _colourTolerance) return false;
+
+	match = neighbour->rotation.t() * (_cameraInverse * Vec3d(u, v, 1.0) * depth - neighbour->translation);
+	return true;
+}
+
+/**
+ * @brief Drop the maps that no map that is still waiting needs
+ */
+void DepthFusion::Trim()
+{
+	auto first = _added - (int)_window.size();
+	while (!_window.empty() && first < _fused - _radius) { delete _window.front(); _window.pop_front(); first++; }
+}
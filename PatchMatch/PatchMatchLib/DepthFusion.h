@@ -0,0 +1,68 @@
+//--------------------------------------------------
+// Engine: Fuses a stream of depth maps into a point cloud, keeping the points that neighbouring maps agree with
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Calibration.h"
+#include "Frame.h"
+#include "VoxelHash.h"
+
+namespace NVL_App
+{
+	class DepthFusion
+	{
+	private:
+		struct View
+		{
+			int id;
+			Mat image;
+			Mat gray;
+			Mat depth;
+			Matx33d rotation;
+			Vec3d translation;
+		};
+
+		Matx33d _camera;
+		Matx33d _cameraInverse;
+		VoxelHash * _voxels;
+		int _radius;
+		double _depthTolerance;
+		double _colourTolerance;
+		int _minConsistent;
+		deque<View *> _window;
+		int _added;
+		int _fused;
+		size_t _accepted;
+		size_t _rejected;
+	public:
+		DepthFusion(Calibration * calibration, VoxelHash * voxels, int radius, double depthTolerance, double colourTolerance, int minConsistent);
+		~DepthFusion();
+
+		void Add(Frame * frame, Mat& depth);
+		void Finish();
+
+		int GetHeld();
+
+		inline VoxelHash *& GetVoxels() { return _voxels; }
+		inline int& GetFused() { return _fused; }
+		inline size_t& GetAccepted() { return _accepted; }
+		inline size_t& GetRejected() { return _rejected; }
+	private:
+		void Fuse(int index);
+		bool Check(View * view, View * neighbour, const Vec3d& point, float intensity, Vec3d& match);
+		void Trim();
+	};
+}
@@ -18,8 +18,9 @@ using namespace NVL_App;
  * @param id The identifier associated with the frame
  * @param image The image represented by the frame
  * @param pose The pose associated with the frame
+ * @remarks A frame may be a crop of a larger capture, in which case GetOffset gives the position of the crop.
  */
-Frame::Frame(int id, Mat& image, Mat& pose) : _id(id), _image(image), _pose(pose)
+Frame::Frame(int id, Mat& image, Mat& pose) : _id(id), _image(image), _pose(pose), _cache(nullptr), _offset(0, 0)
 {
 	// Extra implementation can go here
 }
@@ -29,7 +30,7 @@ Frame::Frame(int id, Mat& image, Mat& pose) : _id(id), _image(image), _pose(pose
  * @param folder The folder that we are loading from
  * @param id The name of the identifier that we are loading from
  */
-Frame::Frame(const string& folder, int id)
+Frame::Frame(const string& folder, int id) : _cache(nullptr), _offset(0, 0)
 {
 	auto imageFile = stringstream(); imageFile << "image_" << setw(4) << setfill('0') << id << ".jpg";
 	auto poseFile = stringstream(); poseFile << "pose_" << setw(4) << setfill('0') << id << ".xml";
@@ -58,3 +59,71 @@ Size Frame::GetSize()
 {
 	return _image.size();
 }
+
+//--------------------------------------------------
+// Derived Images
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the image as a CV_32F grayscale image (the form that is matched)
+ * @return Mat The resultant image
+ */
+Mat Frame::GetGray()
+{
+	return GetDerived(CACHE_GRAY, 0, 0, 0, [this]()
+	{
+		Mat gray = _image; if (_image.channels() == 3) cvtColor(_image, gray, COLOR_BGR2GRAY);
+		Mat result; gray.convertTo(result, CV_32F);
+		return result;
+	});
+}
+
+/**
+ * @brief Retrieve a level of the grayscale pyramid
+ * @param level The level (0 is the grayscale image, and each level halves the size of the one before)
+ * @return Mat The resultant CV_32F image
+ */
+Mat Frame::GetLevel(int level)
+{
+	if (level < 0) throw runtime_error("Pyramid levels cannot be negative");
+	if (level == 0) return GetGray();
+
+	return GetDerived(CACHE_LEVEL, level, 0, 0, [this, level]()
+	{
+		Mat result; pyrDown(GetLevel(level - 1), result);
+		return result;
+	});
+}
+
+/**
+ * @brief Retrieve the statistics of the matching window at every pixel of a pyramid level
+ * @param level The pyramid level
+ * @param window The half-width of the matching window
+ * @param stride The distance between the samples of the window
+ * @return Mat The resultant CV_32FC2 image (the mean and the energy of the window)
+ * @remarks The statistics only depend on the reference, so every kernel of a level shares them.
+ */
+Mat Frame::GetStatistics(int level, int window, int stride)
+{
+	return GetDerived(CACHE_STATISTICS, level, window, stride, [this, level, window, stride]()
+	{
+		Mat image = GetLevel(level);
+		return CostKernel::BuildStatistics(image, window, stride);
+	});
+}
+
+/**
+ * @brief Retrieve a derived image from the cache (or build it when there is no cache)
+ * @param kind The kind of the image
+ * @param level The pyramid level of the image
+ * @param window The window that the image was built with (0 when it does not depend on one)
+ * @param stride The stride that the image was built with (0 when it does not depend on one)
+ * @param factory The function that builds the image
+ * @return Mat The resultant image
+ * @remarks Frames that share a cache must have distinct identifiers.
+ */
+Mat Frame::GetDerived(int kind, int level, int window, int stride, const function<Mat()>& factory)
+{
+	if (_cache == nullptr) return factory();
+	return _cache->Get(ImageCache::Key(_id, kind, level, window, stride), factory);
+}
@@ -16,6 +16,9 @@ using namespace std;
 #include <opencv2/opencv.hpp>
 using namespace cv;
 
+#include "ImageCache.h"
+#include "CostKernel.h"
+
 namespace NVL_App
 {
 	class Frame
@@ -24,14 +27,24 @@ namespace NVL_App
 		int _id;
 		Mat _image;
 		Mat _pose;
+		ImageCache * _cache;
+		Point _offset;
 	public:
 		Frame(int id, Mat& image, Mat& pose);
 		Frame(const string& folder, int id);
 
 		Size GetSize();
 
+		Mat GetGray();
+		Mat GetLevel(int level);
+		Mat GetStatistics(int level, int window, int stride);
+
 		inline int& GetId() { return _id; }
 		inline Mat& GetImage() { return _image; }
 		inline Mat& GetPose() { return _pose; }
+		inline ImageCache *& GetCache() { return _cache; }
+		inline Point& GetOffset() { return _offset; }
+	private:
+		Mat GetDerived(int kind, int level, int window, int stride, const function<Mat()>& factory);
 	};
 }
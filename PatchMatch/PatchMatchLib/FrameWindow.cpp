@@ -0,0 +1,86 @@
+//--------------------------------------------------
+// Implementation of class FrameWindow
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "FrameWindow.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param ids The identifiers of the frames of the sequence, in order
+ * @param loader The function that loads a frame (the window takes ownership of the frame)
+ * @param capacity The largest number of frames that are held at once
+ */
+FrameWindow::FrameWindow(const vector<int>& ids, const Loader& loader, int capacity) : _ids(ids), _loader(loader), _first(0), _end(0), _loads(0)
+{
+	if (capacity <= 0) throw runtime_error("The frame window must hold at least one frame");
+	_slots = vector<Frame *>(capacity, nullptr);
+}
+
+/**
+ * @brief Main Terminator
+ */
+FrameWindow::~FrameWindow()
+{
+	for (auto frame : _slots) delete frame;
+}
+
+//--------------------------------------------------
+// Window
+//--------------------------------------------------
+
+/**
+ * @brief Move the window so that it holds the frames in [first, end) of the sequence
+ * @param first The position of the first frame that is needed
+ * @param end The position after the last frame that is needed (clipped to the length of the sequence)
+ * @remarks The window only moves forward. Frames that are already held are kept, the frames before the window are
+ * released, and only the new frames are loaded, so a frame is loaded once however many references use it.
+ */
+void FrameWindow::Advance(int first, int end)
+{
+	first = max(first, 0); end = min(end, (int)_ids.size());
+	if (first < _first || end < _end) throw runtime_error("The frame window can only move forward");
+	if (end - first > (int)_slots.size()) throw runtime_error("The frame window is too small for the requested frames");
+
+	for (auto position = _first; position < min(first, _end); position++) Release(position);
+
+	for (auto position = max(first, _end); position < end; position++)
+	{
+		_slots[position % _slots.size()] = _loader(_ids[position]); _loads++;
+	}
+
+	_first = first; _end = end;
+}
+
+/**
+ * @brief Retrieve a frame that the window holds
+ * @param position The position of the frame in the sequence
+ * @return Frame * The frame
+ */
+Frame * FrameWindow::Get(int position)
+{
+	if (position < _first || position >= _end) throw runtime_error("The requested frame is outside the frame window");
+	return _slots[position % _slots.size()];
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Free the frame at a position of the sequence
+ * @param position The position
+ */
+void FrameWindow::Release(int position)
+{
+	auto& slot = _slots[position % _slots.size()];
+	delete slot; slot = nullptr;
+}
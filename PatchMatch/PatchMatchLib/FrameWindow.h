@@ -0,0 +1,46 @@
+//--------------------------------------------------
+// Utility: A ring buffer of the frames of a sequence that are still needed (each frame is loaded once)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+#include <functional>
+using namespace std;
+
+#include "Frame.h"
+
+namespace NVL_App
+{
+	class FrameWindow
+	{
+	public:
+		typedef function<Frame *(int id)> Loader;
+	private:
+		vector<int> _ids;
+		Loader _loader;
+		vector<Frame *> _slots;
+		int _first;
+		int _end;
+		int _loads;
+	public:
+		FrameWindow(const vector<int>& ids, const Loader& loader, int capacity);
+		~FrameWindow();
+
+		void Advance(int first, int end);
+		Frame * Get(int position);
+
+		inline vector<int>& GetIds() { return _ids; }
+		inline int& GetFirst() { return _first; }
+		inline int& GetEnd() { return _end; }
+		inline int& GetLoads() { return _loads; }
+		inline int GetCapacity() { return (int)_slots.size(); }
+	private:
+		void Release(int position);
+	};
+}
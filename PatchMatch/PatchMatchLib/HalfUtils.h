@@ -0,0 +1,160 @@
+//--------------------------------------------------
+// Utility: Access to maps that are stored in either single (CV_32F) or half (CV_16F) precision
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+#include <type_traits>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_App
+{
+	class HalfUtils
+	{
+	public:
+		/**
+		 * @brief Find the type of a map that is stored in a given precision
+		 * @param channels The number of channels of the map
+		 * @return int CV_32FC(channels) when T is float, or CV_16FC(channels) when T is float16_t
+		 */
+		template <typename T> static inline int GetType(int channels)
+		{
+			auto depth = is_same<T, float>::value ? CV_32F : CV_16F;
+			return CV_MAKETYPE(depth, channels);
+		}
+
+		/**
+		 * @brief Read a value from a single channel map
+		 * @param map The map (CV_32FC1 when T is float, or CV_16FC1 when T is float16_t)
+		 * @param x The x coordinate of the pixel
+		 * @param y The y coordinate of the pixel
+		 * @return float The value, widened to single precision
+		 */
+		template <typename T> static inline float Get(const Mat& map, int x, int y)
+		{
+			return (float)map.at<T>(y, x);
+		}
+
+		/**
+		 * @brief Write a value to a single channel map
+		 * @param map The map (CV_32FC1 when T is float, or CV_16FC1 when T is float16_t)
+		 * @param x The x coordinate of the pixel
+		 * @param y The y coordinate of the pixel
+		 * @param value The value (rounded to the nearest half when the map is half precision)
+		 */
+		template <typename T> static inline void Set(Mat& map, int x, int y, float value)
+		{
+			map.at<T>(y, x) = T(value);
+		}
+
+		/**
+		 * @brief Read a vector from a three channel map
+		 * @param map The map (CV_32FC3 when T is float, or CV_16FC3 when T is float16_t)
+		 * @param x The x coordinate of the pixel
+		 * @param y The y coordinate of the pixel
+		 * @return Vec3f The vector, widened to single precision
+		 */
+		template <typename T> static inline Vec3f GetVector(const Mat& map, int x, int y)
+		{
+			auto& value = map.at<Vec<T, 3>>(y, x);
+			return Vec3f((float)value[0], (float)value[1], (float)value[2]);
+		}
+
+		/**
+		 * @brief Write a vector to a three channel map
+		 * @param map The map (CV_32FC3 when T is float, or CV_16FC3 when T is float16_t)
+		 * @param x The x coordinate of the pixel
+		 * @param y The y coordinate of the pixel
+		 * @param value The vector
+		 */
+		template <typename T> static inline void SetVector(Mat& map, int x, int y, const Vec3f& value)
+		{
+			auto& target = map.at<Vec<T, 3>>(y, x);
+			target[0] = T(value[0]); target[1] = T(value[1]); target[2] = T(value[2]);
+		}
+
+		/**
+		 * @brief Read a row of a map in single precision
+		 * @param map The map (stored as T, with any number of channels)
+		 * @param row The row
+		 * @param buffer Room for a row of single precision values (only used when the map is half precision)
+		 * @return const float * The row itself when the map is single precision, or the buffer that it was widened into
+		 * @remarks The row is widened with one convertTo call, which OpenCV vectorizes (with F16C where it is built in).
+		 */
+		template <typename T> static inline const float * ReadRow(const Mat& map, int row, float * buffer)
+		{
+			if (is_same<T, float>::value) return map.ptr<float>(row);
+
+			auto source = Mat(1, map.cols, map.type(), (void *)map.ptr<T>(row)); auto target = Mat(1, map.cols, CV_32FC(map.channels()), buffer);
+			source.convertTo(target, CV_32F);
+			return buffer;
+		}
+
+		/**
+		 * @brief Find where a row of single precision values should be written, before it is stored with WriteRow
+		 * @param map The map (stored as T, with any number of channels)
+		 * @param row The row
+		 * @param buffer Room for a row of single precision values (only used when the map is half precision)
+		 * @return float * The row itself when the map is single precision, or the buffer
+		 */
+		template <typename T> static inline float * GetRowBuffer(Mat& map, int row, float * buffer)
+		{
+			return is_same<T, float>::value ? map.ptr<float>(row) : buffer;
+		}
+
+		/**
+		 * @brief Store a row of single precision values that was written to the place that GetRowBuffer gave
+		 * @param map The map (stored as T, with any number of channels)
+		 * @param row The row
+		 * @param values The values (nothing is copied when they are the row itself)
+		 */
+		template <typename T> static inline void WriteRow(Mat& map, int row, const float * values)
+		{
+			if (is_same<T, float>::value) return;
+
+			auto source = Mat(1, map.cols, CV_32FC(map.channels()), (void *)values); auto target = Mat(1, map.cols, map.type(), (void *)map.ptr<T>(row));
+			source.convertTo(target, map.depth());
+		}
+
+		/**
+		 * @brief Find the number of bytes that a map holds
+		 * @param map The map
+		 * @return size_t The resultant byte count
+		 */
+		static inline size_t GetBytes(const Mat& map)
+		{
+			return map.total() * map.elemSize();
+		}
+
+		/**
+		 * @brief Convert a map to the precision that it is stored in
+		 * @param map The map, which is replaced by the converted map
+		 * @param half True to store it in half precision, false for single precision
+		 */
+		static inline void Store(Mat& map, bool half)
+		{
+			auto depth = half ? CV_16F : CV_32F;
+			if (!map.empty() && map.depth() != depth) { Mat result; map.convertTo(result, depth); map = result; }
+		}
+
+		/**
+		 * @brief Retrieve a map in single precision
+		 * @param map The map
+		 * @return Mat The map itself if it is already single precision, or a widened copy
+		 */
+		static inline Mat ToFloat(const Mat& map)
+		{
+			if (map.depth() == CV_32F) return map;
+			Mat result; map.convertTo(result, CV_32F);
+			return result;
+		}
+	};
+}
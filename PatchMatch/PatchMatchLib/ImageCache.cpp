@@ -0,0 +1,142 @@
+//--------------------------------------------------
+// Implementation of class ImageCache
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ImageCache.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param limit The number of bytes that the cache may hold before it starts evicting
+ */
+ImageCache::ImageCache(size_t limit) : _limit(limit), _bytes(0), _hits(0), _misses(0), _evictions(0)
+{
+	// Extra implementation can go here
+}
+
+//--------------------------------------------------
+// Retrieval
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve an image, building it if it is not in the cache
+ * @param key The key of the image (frame identifier, kind, level, and the window and stride it was built with)
+ * @param factory The function that builds the image
+ * @return Mat The image (shared with the cache, so it must not be written to)
+ * @remarks The factory runs without the lock held, so it may ask the cache for other images. A caller that asks
+ * for an image that another thread is already building waits for it instead of building it again. An evicted
+ * image stays valid for any caller that still holds it.
+ */
+Mat ImageCache::Get(const Key& key, const function<Mat()>& factory)
+{
+	{
+		auto guard = unique_lock<mutex>(_lock);
+
+		auto entry = _entries.find(key);
+		while (entry != _entries.end() && !entry->second.ready)
+		{
+			_ready.wait(guard); entry = _entries.find(key);
+		}
+
+		if (entry != _entries.end())
+		{
+			_order.splice(_order.begin(), _order, entry->second.position);
+			_hits++; return entry->second.image;
+		}
+
+		_order.push_front(key);
+		_entries[key] = Entry { Mat(), 0, false, _order.begin() };
+		_misses++;
+	}
+
+	Mat image;
+	try { image = factory(); }
+	catch (...)
+	{
+		auto guard = unique_lock<mutex>(_lock);
+		_order.erase(_entries[key].position); _entries.erase(key);
+		_ready.notify_all(); throw;
+	}
+
+	auto guard = unique_lock<mutex>(_lock);
+	auto& entry = _entries[key];
+	entry.image = image; entry.bytes = image.total() * image.elemSize(); entry.ready = true;
+	_bytes += entry.bytes;
+
+	Evict(key);
+	_ready.notify_all();
+
+	return image;
+}
+
+/**
+ * @brief Remove every image that is not being built
+ */
+void ImageCache::Clear()
+{
+	auto guard = unique_lock<mutex>(_lock);
+
+	for (auto entry = _entries.begin(); entry != _entries.end();)
+	{
+		if (!entry->second.ready) { entry++; continue; }
+		_bytes -= entry->second.bytes; _order.erase(entry->second.position);
+		entry = _entries.erase(entry);
+	}
+}
+
+//--------------------------------------------------
+// Statistics
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the number of bytes that are held
+ * @return size_t The number of bytes
+ */
+size_t ImageCache::GetBytes()
+{
+	auto guard = unique_lock<mutex>(_lock);
+	return _bytes;
+}
+
+/**
+ * @brief Retrieve the number of images that are held
+ * @return int The number of images
+ */
+int ImageCache::GetCount()
+{
+	auto guard = unique_lock<mutex>(_lock);
+	return (int)_entries.size();
+}
+
+//--------------------------------------------------
+// Eviction
+//--------------------------------------------------
+
+/**
+ * @brief Remove the least recently used images until the cache is within its limit
+ * @param keep The image that was just added (it is kept even if it is larger than the limit on its own)
+ * @remarks Called with the lock held. Images that are still being built are skipped.
+ */
+void ImageCache::Evict(const Key& keep)
+{
+	auto position = _order.end();
+
+	while (_bytes > _limit && position != _order.begin())
+	{
+		position--;
+
+		auto& entry = _entries[*position];
+		if (*position == keep || !entry.ready) continue;
+
+		_bytes -= entry.bytes; _evictions++;
+		_entries.erase(*position); position = _order.erase(position);
+	}
+}
@@ -0,0 +1,71 @@
+//--------------------------------------------------
+// Utility: A thread-safe, memory-capped store of the images that are derived from frames (LRU eviction)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <list>
+#include <tuple>
+#include <mutex>
+#include <iostream>
+#include <functional>
+#include <condition_variable>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define CACHE_GRAY 0
+#define CACHE_LEVEL 1
+#define CACHE_STATISTICS 2
+
+namespace NVL_App
+{
+	class ImageCache
+	{
+	public:
+		typedef tuple<int, int, int, int, int> Key;
+	private:
+		struct Entry
+		{
+			Mat image;
+			size_t bytes;
+			bool ready;
+			list<Key>::iterator position;
+		};
+
+		size_t _limit;
+		size_t _bytes;
+		int _hits;
+		int _misses;
+		int _evictions;
+		map<Key, Entry> _entries;
+		list<Key> _order;
+		mutex _lock;
+		condition_variable _ready;
+	public:
+		ImageCache(size_t limit);
+
+		Mat Get(const Key& key, const function<Mat()>& factory);
+		void Clear();
+
+		size_t GetBytes();
+		int GetCount();
+
+		inline size_t& GetLimit() { return _limit; }
+		inline int& GetHits() { return _hits; }
+		inline int& GetMisses() { return _misses; }
+		inline int& GetEvictions() { return _evictions; }
+	private:
+		void Evict(const Key& keep);
+	};
+}
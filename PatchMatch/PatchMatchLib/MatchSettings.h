@@ -0,0 +1,79 @@
+//--------------------------------------------------
+// Model: The settings that control a PatchMatch run
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define SELECT_TOP_K 0
+#define SELECT_SAMPLE 1
+
+namespace NVL_App
+{
+	class MatchSettings
+	{
+	private:
+		double _minDepth;
+		double _maxDepth;
+		int _window;
+		int _stride;
+		int _iterations;
+		int _refineSteps;
+		int _viewCount;
+		int _selection;
+		int _levels;
+		int _levelIterations;
+		double _minActive;
+		int _seed;
+		bool _halfPrecision;
+		int _threads;
+	public:
+		/**
+		 * @brief Main Constructor
+		 * @param minDepth The smallest depth that a hypothesis may have
+		 * @param maxDepth The largest depth that a hypothesis may have
+		 * @param window The half-width of the matching window (the window is 2 * window + 1 pixels wide)
+		 * @param iterations The number of propagation iterations (at the coarsest pyramid level)
+		 * @param refineSteps The number of times the random refinement halves its search range
+		 * @remarks The remaining settings start as a dense two-view match at full resolution, and are changed through
+		 * their accessors (e.g. settings.GetViewCount() = 3):
+		 * - stride: the distance between the samples of the window (1 samples every pixel)
+		 * - viewCount: the number of source views that each pixel is scored against
+		 * - selection: how the views of a pixel are chosen (SELECT_TOP_K or SELECT_SAMPLE)
+		 * - levels: the number of pyramid levels (1 matches at full resolution only)
+		 * - levelIterations: the number of iterations at each level after the coarsest
+		 * - minActive: a level stops early once the fraction of active pixels falls below this (0 never stops)
+		 * - seed: the seed of the random numbers (a run is reproducible for a given seed)
+		 * - halfPrecision: store the depths, normals and costs of the run in half precision (halving their memory)
+		 * - threads: the number of threads that the row loops of a run use (0 hands them to the OpenCV pool)
+		 */
+		MatchSettings(double minDepth, double maxDepth, int window, int iterations, int refineSteps) :
+			_minDepth(minDepth), _maxDepth(maxDepth), _window(window), _stride(1), _iterations(iterations), _refineSteps(refineSteps), _viewCount(1), _selection(SELECT_TOP_K),
+			_levels(1), _levelIterations(1), _minActive(0), _seed(1), _halfPrecision(false), _threads(0) {}
+
+		inline double& GetMinDepth() { return _minDepth; }
+		inline double& GetMaxDepth() { return _maxDepth; }
+		inline int& GetWindow() { return _window; }
+		inline int& GetStride() { return _stride; }
+		inline int& GetIterations() { return _iterations; }
+		inline int& GetRefineSteps() { return _refineSteps; }
+		inline int& GetViewCount() { return _viewCount; }
+		inline int& GetSelection() { return _selection; }
+		inline int& GetLevels() { return _levels; }
+		inline int& GetLevelIterations() { return _levelIterations; }
+		inline double& GetMinActive() { return _minActive; }
+		inline int& GetSeed() { return _seed; }
+		inline bool& GetHalfPrecision() { return _halfPrecision; }
+		inline int& GetThreads() { return _threads; }
+	};
+}
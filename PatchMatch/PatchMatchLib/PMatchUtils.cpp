@@ -0,0 +1,190 @@
+//--------------------------------------------------
+// Implementation of class PMatchUtils
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "PMatchUtils.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Initialize
+//--------------------------------------------------
+
+/**
+ * @brief Generate an initial depth map
+ * @param size The size that we want the map to be
+ * @param minValue The minimum value that we want to initialize with
+ * @param maxValue The maximum value that we want to initialize with
+ * @param seed The seed of the run
+ * @param stream The random stream of the map (each pixel draws from its own position in it)
+ * @return Mat A CV_32F map of uniformly distributed values
+ */
+Mat PMatchUtils::CreateMap(const Size& size, double minValue, double maxValue, uint64_t seed, uint32_t stream)
+{
+	Mat result = Mat(size, CV_32FC1);
+
+	parallel_for_(Range(0, result.rows), [&](const Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto values = result.ptr<float>(row);
+			for (auto column = 0; column < result.cols; column++)
+			{
+				auto rng = CounterRng(seed, stream, (uint64_t)row * result.cols + column);
+				values[column] = rng.Uniform((float)minValue, (float)maxValue);
+			}
+		}
+	});
+
+	return result;
+}
+
+/**
+ * @brief Generate an initial normal map
+ * @param size The size that we want the map to be
+ * @param seed The seed of the run
+ * @param stream The random stream of the map (each pixel draws from its own position in it)
+ * @return Mat A CV_32FC3 map of random unit normals that face the camera
+ */
+Mat PMatchUtils::CreateNormals(const Size& size, uint64_t seed, uint32_t stream)
+{
+	Mat result = Mat(size, CV_32FC3);
+
+	parallel_for_(Range(0, result.rows), [&](const Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto normals = result.ptr<Vec3f>(row);
+			for (auto column = 0; column < result.cols; column++)
+			{
+				auto rng = CounterRng(seed, stream, (uint64_t)row * result.cols + column);
+				normals[column] = GetRandomNormal(rng);
+			}
+		}
+	});
+
+	return result;
+}
+
+/**
+ * @brief Generate a random unit normal that faces the camera
+ * @param rng The random number generator that we are drawing from
+ * @return Vec3f The resultant normal (with a negative z component)
+ */
+Vec3f PMatchUtils::GetRandomNormal(CounterRng& rng)
+{
+	auto z = rng.Uniform(-1.0f, -0.1f); auto angle = rng.Uniform(0.0f, (float)(2 * M_PI));
+	auto radius = sqrt(1.0f - z * z);
+	return Vec3f(radius * cos(angle), radius * sin(angle), z);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find the transform from the reference camera to the source camera
+ * @param referencePose The pose (world to camera) of the reference frame
+ * @param sourcePose The pose (world to camera) of the source frame
+ * @return Mat The 4x4 relative transform
+ */
+Mat PMatchUtils::GetRelativePose(Mat& referencePose, Mat& sourcePose)
+{
+	Mat reference; referencePose.convertTo(reference, CV_64F);
+	Mat source; sourcePose.convertTo(source, CV_64F);
+	Mat result = source * reference.inv();
+	return result;
+}
+
+/**
+ * @brief Find the camera matrix of a pyramid level
+ * @param camera The camera matrix at full resolution
+ * @param level The pyramid level (each level halves the size of the one before)
+ * @return Mat The resultant CV_64F camera matrix
+ * @remarks The principal point is scaled about pixel centres, since a pixel of the level covers the centres of
+ * the pixels below it.
+ */
+Mat PMatchUtils::ScaleCamera(Mat& camera, int level)
+{
+	Mat result; camera.convertTo(result, CV_64F); auto scale = 1.0 / (1 << level);
+
+	result.at<double>(0, 0) *= scale; result.at<double>(0, 1) *= scale; result.at<double>(1, 1) *= scale;
+	result.at<double>(0, 2) = (result.at<double>(0, 2) + 0.5) * scale - 0.5;
+	result.at<double>(1, 2) = (result.at<double>(1, 2) + 0.5) * scale - 0.5;
+
+	return result;
+}
+
+/**
+ * @brief Find the camera matrix of a crop of the image
+ * @param camera The camera matrix of the full image
+ * @param offset The position of the crop within the full image
+ * @return Mat The resultant CV_64F camera matrix (the principal point moves, nothing else changes)
+ */
+Mat PMatchUtils::CropCamera(Mat& camera, const Point& offset)
+{
+	Mat result; camera.convertTo(result, CV_64F);
+	result.at<double>(0, 2) -= offset.x; result.at<double>(1, 2) -= offset.y;
+	return result;
+}
+
+/**
+ * @brief Build the confidence of each pixel from its cost
+ * @param costs The CV_32F cost of each pixel
+ * @return Mat A CV_32F map in [0, 1] (the ZNCC of the hypothesis, clamped at 0)
+ */
+Mat PMatchUtils::GetConfidence(Mat& costs)
+{
+	Mat result = Mat(costs.size(), CV_32FC1);
+
+	for (auto row = 0; row < costs.rows; row++)
+	{
+		auto costRow = costs.ptr<float>(row); auto confidence = result.ptr<float>(row);
+		for (auto column = 0; column < costs.cols; column++) confidence[column] = max(0.0f, 1.0f - costRow[column]);
+	}
+
+	return result;
+}
+
+/**
+ * @brief Move the depth map of another view into the reference view (the view propagation step)
+ * @param camera The camera matrix (shared by both views)
+ * @param pose The 4x4 transform from the other camera to the reference camera
+ * @param depth The depth map of the other view
+ * @param normals The normal map of the other view
+ * @param outDepth The depth of each reference pixel (0 where nothing projects)
+ * @param outNormals The normal of each reference pixel (in reference camera coordinates)
+ * @remarks When several points land on the same pixel the closest is kept.
+ */
+void PMatchUtils::TransferDepth(Mat& camera, Mat& pose, Mat& depth, Mat& normals, Mat& outDepth, Mat& outNormals)
+{
+	auto pair = ViewPair(camera, depth, depth, pose);
+	auto& K = pair.GetCamera(); auto& R = pair.GetRotation(); auto& t = pair.GetTranslation();
+
+	outDepth = Mat(depth.size(), CV_32FC1, Scalar::all(0)); outNormals = Mat(depth.size(), CV_32FC3, Scalar::all(0));
+
+	for (auto row = 0; row < depth.rows; row++)
+	{
+		auto depths = depth.ptr<float>(row); auto normalRow = normals.ptr<Vec3f>(row);
+		for (auto column = 0; column < depth.cols; column++)
+		{
+			if (depths[column] <= 0) continue;
+
+			auto point = R * (pair.GetRay(column, row) * (double)depths[column]) + t;
+			if (point[2] <= 0) continue;
+
+			auto pixel = K * point;
+			auto u = (int)round(pixel[0] / pixel[2]); auto v = (int)round(pixel[1] / pixel[2]);
+			if (u < 0 || v < 0 || u >= depth.cols || v >= depth.rows) continue;
+
+			auto& target = outDepth.at<float>(v, u);
+			if (target > 0 && target <= point[2]) continue;
+
+			auto normal = R * Vec3d(normalRow[column][0], normalRow[column][1], normalRow[column][2]);
+			target = (float)point[2]; outNormals.at<Vec3f>(v, u) = Vec3f((float)normal[0], (float)normal[1], (float)normal[2]);
+		}
+	}
+}
@@ -0,0 +1,37 @@
+//--------------------------------------------------
+// Utility: A set of utilities for the patchmatch algorithm
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Calibration.h"
+#include "ViewPair.h"
+#include "CounterRng.h"
+
+namespace NVL_App
+{
+	class PMatchUtils
+	{
+	public:
+		static Mat CreateMap(const Size& size, double minValue, double maxValue, uint64_t seed, uint32_t stream);
+		static Mat CreateNormals(const Size& size, uint64_t seed, uint32_t stream);
+		static Vec3f GetRandomNormal(CounterRng& rng);
+
+		static Mat GetRelativePose(Mat& referencePose, Mat& sourcePose);
+		static Mat ScaleCamera(Mat& camera, int level);
+		static Mat CropCamera(Mat& camera, const Point& offset);
+		static Mat GetConfidence(Mat& costs);
+		static void TransferDepth(Mat& camera, Mat& pose, Mat& depth, Mat& normals, Mat& outDepth, Mat& outNormals);
+	};
+}
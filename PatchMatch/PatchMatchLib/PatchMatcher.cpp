@@ -0,0 +1,690 @@
+//--------------------------------------------------
+// Implementation of class PatchMatcher
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "PatchMatcher.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define STREAM_DEPTH 0
+#define STREAM_NORMALS 1
+#define STREAM_VIEWS 2
+#define STREAM_PASS 3
+#define NEIGHBOUR_COUNT 8
+#define REFINE_COUNT 3
+#define MAX_VIEWS 32
+#define SAMPLE_SIGMA 0.3f
+#define MIN_LEVEL_SIZE 16
+#define LEVEL_REFINE_SCALE 0.25f
+#define CONVERGE_COST 0.005f
+#define RESCORE_COUNT 2
+
+// Every offset has an odd length, so a neighbour always has the other colour of the checkerboard
+static const int NEIGHBOURS[NEIGHBOUR_COUNT][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 }, { -5, 0 }, { 5, 0 }, { 0, -5 }, { 0, 5 } };
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param calibration The calibration of the camera (the frames are assumed to be undistorted)
+ * @param reference The frame that the depth map is found for
+ * @param sources The frames that the reference is matched against (at most 32)
+ * @param settings The settings of the run
+ * @remarks The view pairs are built for each pyramid level as Run reaches it, from the images that the frames cache.
+ */
+PatchMatcher::PatchMatcher(Calibration * calibration, Frame * reference, vector<Frame *>& sources, MatchSettings& settings) :
+	_camera(calibration->GetCamera()), _reference(reference), _sources(sources), _level(0), _refineScale(1.0f), _settings(settings), _passes(0), _updates(0), _peakBytes(0)
+{
+	if (sources.empty()) throw runtime_error("PatchMatch needs at least one source frame");
+	if (sources.size() > MAX_VIEWS) throw runtime_error("PatchMatch supports at most 32 source frames");
+
+	_settings.GetViewCount() = max(1, min(_settings.GetViewCount(), (int)sources.size()));
+}
+
+/**
+ * @brief Main Terminator
+ */
+PatchMatcher::~PatchMatcher()
+{
+	ReleaseLevel();
+}
+
+//--------------------------------------------------
+// Execution
+//--------------------------------------------------
+
+/**
+ * @brief Add the hypotheses of another view, so that they are tested during propagation
+ * @param depth The depth of each reference pixel (0 where there is no hypothesis)
+ * @param normals The normal of each reference pixel
+ * @remarks This is the view propagation hook: a depth map that was found for another frame is moved into
+ * this reference with PMatchUtils::TransferDepth and passed in here. Priors are full resolution, so they are
+ * only tested at the finest pyramid level. They are stored in the precision of the run.
+ */
+void PatchMatcher::AddPrior(Mat& depth, Mat& normals)
+{
+	_priorDepths.push_back(depth.clone()); _priorNormals.push_back(normals.clone());
+	HalfUtils::Store(_priorDepths.back(), _settings.GetHalfPrecision()); HalfUtils::Store(_priorNormals.back(), _settings.GetHalfPrecision());
+}
+
+/**
+ * @brief Find the depth map
+ * @remarks The coarsest pyramid level starts from random hypotheses and runs the full number of iterations. Each
+ * finer level starts from the upsampled result of the level below, which is already close, so it only needs a
+ * couple of iterations. Each iteration visits the two colours of a checkerboard in turn. Neighbours always have
+ * the other colour, so every pixel of a colour can be updated in parallel without locks, while each pass still
+ * sees the hypotheses that the previous pass produced. After the first iteration of a level, only the active
+ * pixels are visited, and the level stops once too few of them remain. In half precision the depths, normals
+ * and costs are held as CV_16F while the run lasts, and are widened to CV_32F once it ends. The precision is
+ * chosen once here, so the pixel loops below it are compiled for one storage type and never branch on it.
+ */
+void PatchMatcher::Run()
+{
+	_passes = 0; _updates = 0; _peakBytes = 0;
+	if (_settings.GetHalfPrecision()) RunLevels<float16_t>(); else RunLevels<float>();
+
+	_depth = HalfUtils::ToFloat(_depth); _normals = HalfUtils::ToFloat(_normals); _costs = HalfUtils::ToFloat(_costs);
+	_scores.clear();
+}
+
+/**
+ * @brief Run every pyramid level, coarsest first
+ * @remarks T is the type that the maps of the run are stored as (float, or float16_t in half precision).
+ */
+template <typename T> void PatchMatcher::RunLevels()
+{
+	auto levels = GetLevelCount();
+
+	for (auto level = levels - 1; level >= 0; level--)
+	{
+		BuildLevel(level);
+		if (level == levels - 1) Initialize<T>(); else Upsample<T>();
+
+		auto iterations = level == levels - 1 ? _settings.GetIterations() : _settings.GetLevelIterations();
+		auto active = ResetActive(); auto total = (double)_depth.total();
+
+		for (auto iteration = 0; iteration < iterations; iteration++)
+		{
+			Iterate<T>(_passes, 0); Iterate<T>(_passes, 1);
+			_passes++; _updates += active;
+
+			active = UpdateActive();
+			if (active < total * _settings.GetMinActive()) break;
+		}
+	}
+}
+
+/**
+ * @brief Build the confidence of each pixel from its cost
+ * @return Mat A CV_32F map in [0, 1] (the ZNCC of the final hypothesis, clamped at 0)
+ */
+Mat PatchMatcher::GetConfidence()
+{
+	return PMatchUtils::GetConfidence(_costs);
+}
+
+//--------------------------------------------------
+// Levels
+//--------------------------------------------------
+
+/**
+ * @brief Find the number of pyramid levels that are used
+ * @return int The requested number of levels, less any that would make the coarsest level smaller than 16 pixels
+ */
+int PatchMatcher::GetLevelCount()
+{
+	auto size = _reference->GetSize(); auto result = max(1, _settings.GetLevels());
+	while (result > 1 && (min(size.width, size.height) >> (result - 1)) < MIN_LEVEL_SIZE) result--;
+	return result;
+}
+
+/**
+ * @brief Build the view pairs and kernels of a pyramid level
+ * @param level The level (0 is full resolution)
+ */
+void PatchMatcher::BuildLevel(int level)
+{
+	ReleaseLevel(); _level = level;
+
+	Mat referenceCrop = PMatchUtils::CropCamera(_camera, _reference->GetOffset());
+	Mat camera = PMatchUtils::ScaleCamera(referenceCrop, level);
+	Mat referenceImage = _reference->GetLevel(level);
+	Mat statistics = _reference->GetStatistics(level, _settings.GetWindow(), _settings.GetStride());
+
+	for (auto source : _sources)
+	{
+		Mat sourceCrop = PMatchUtils::CropCamera(_camera, source->GetOffset());
+		Mat sourceCamera = PMatchUtils::ScaleCamera(sourceCrop, level);
+		Mat sourceImage = source->GetLevel(level);
+		Mat pose = PMatchUtils::GetRelativePose(_reference->GetPose(), source->GetPose());
+
+		_pairs.push_back(new ViewPair(camera, sourceCamera, referenceImage, sourceImage, pose));
+		_kernels.push_back(new CostKernel(_pairs.back(), _settings.GetWindow(), _settings.GetStride(), statistics));
+	}
+}
+
+/**
+ * @brief Free the view pairs and kernels of the current level
+ */
+void PatchMatcher::ReleaseLevel()
+{
+	for (auto kernel : _kernels) delete kernel;
+	for (auto pair : _pairs) delete pair;
+	_kernels.clear(); _pairs.clear();
+}
+
+//--------------------------------------------------
+// Stages
+//--------------------------------------------------
+
+/**
+ * @brief Give every pixel a random hypothesis, choose its views and score it
+ */
+template <typename T> void PatchMatcher::Initialize()
+{
+	auto size = _pairs[0]->GetReference().size(); uint64_t seed = _settings.GetSeed();
+
+	_depth = PMatchUtils::CreateMap(size, _settings.GetMinDepth(), _settings.GetMaxDepth(), seed, GetStream(STREAM_DEPTH, 0));
+	_normals = PMatchUtils::CreateNormals(size, seed, GetStream(STREAM_NORMALS, 0));
+	HalfUtils::Store(_depth, _settings.GetHalfPrecision()); HalfUtils::Store(_normals, _settings.GetHalfPrecision());
+	_refineScale = 1.0f;
+
+	ChooseAll<T>();
+}
+
+/**
+ * @brief Start a level from the hypotheses of the level below, then choose the views and score them
+ * @remarks The hypotheses are interpolated bilinearly (about pixel centres) a row at a time, so only the two coarse
+ * rows that a fine row needs are widened to single precision. Depth is metric, so it carries over unchanged, while
+ * the normals are renormalized, since interpolated normals are shorter than unit. The upsampled hypotheses are
+ * already close, so refinement starts from a quarter of the full range.
+ */
+template <typename T> void PatchMatcher::Upsample()
+{
+	auto size = _pairs[0]->GetReference().size();
+	Mat coarseDepth = _depth; Mat coarseNormals = _normals; auto width = coarseDepth.cols;
+	_depth = Mat(size, HalfUtils::GetType<T>(1)); _normals = Mat(size, HalfUtils::GetType<T>(3));
+	UpdatePeak(HalfUtils::GetBytes(coarseDepth) + HalfUtils::GetBytes(coarseNormals));
+
+	auto getTap = [](int target, int source, double scale, int& first, float& weight)
+	{
+		auto position = (target + 0.5) * scale - 0.5; first = (int)floor(position); weight = (float)(position - first);
+		if (first < 0) { first = 0; weight = 0; }
+		if (first >= source - 1) { first = source - 1; weight = 0; }
+	};
+
+	auto lefts = vector<int>(size.width); auto across = vector<float>(size.width);
+	for (auto column = 0; column < size.width; column++) getTap(column, width, (double)width / size.width, lefts[column], across[column]);
+
+	ForRows(size.height, [&](const Range& range)
+	{
+		auto depthBuffer = vector<float>(2 * width); auto normalBuffer = vector<Vec3f>(2 * width);
+		auto depthRow = vector<float>(size.width); auto normalRow = vector<Vec3f>(size.width);
+
+		for (auto row = range.start; row < range.end; row++)
+		{
+			int top; float down; getTap(row, coarseDepth.rows, (double)coarseDepth.rows / size.height, top, down);
+			auto bottom = min(top + 1, coarseDepth.rows - 1);
+
+			const float * depths[2] = { HalfUtils::ReadRow<T>(coarseDepth, top, &depthBuffer[0]), HalfUtils::ReadRow<T>(coarseDepth, bottom, &depthBuffer[width]) };
+			const Vec3f * normals[2] = { (const Vec3f *)HalfUtils::ReadRow<T>(coarseNormals, top, (float *)&normalBuffer[0]), (const Vec3f *)HalfUtils::ReadRow<T>(coarseNormals, bottom, (float *)&normalBuffer[width]) };
+			auto outDepths = HalfUtils::GetRowBuffer<T>(_depth, row, depthRow.data()); auto outNormals = (Vec3f *)HalfUtils::GetRowBuffer<T>(_normals, row, (float *)normalRow.data());
+
+			for (auto column = 0; column < size.width; column++)
+			{
+				auto left = lefts[column]; auto right = min(left + 1, width - 1); auto weight = across[column];
+
+				auto upper = depths[0][left] * (1 - weight) + depths[0][right] * weight; auto lower = depths[1][left] * (1 - weight) + depths[1][right] * weight;
+				outDepths[column] = upper * (1 - down) + lower * down;
+
+				auto upperNormal = normals[0][left] * (1 - weight) + normals[0][right] * weight; auto lowerNormal = normals[1][left] * (1 - weight) + normals[1][right] * weight;
+				auto normal = upperNormal * (1 - down) + lowerNormal * down; auto length = norm(normal);
+				outNormals[column] = length > 1e-6 ? normal * (float)(1.0 / length) : Vec3f(0, 0, -1);
+			}
+
+			HalfUtils::WriteRow<T>(_depth, row, outDepths); HalfUtils::WriteRow<T>(_normals, row, (const float *)outNormals);
+		}
+	});
+
+	_refineScale = LEVEL_REFINE_SCALE;
+	ChooseAll<T>();
+}
+
+/**
+ * @brief Score the hypothesis of every pixel in every view, then choose the views of each pixel
+ * @remarks The per-view scores are held in the precision of the run, since there is a full map for every view.
+ * They are kept for the level, so that Select only has to refresh some of them on each pass. The hypotheses are
+ * widened a row at a time, and the views are chosen from the scores as they are stored (rounded in half
+ * precision), which are the values that Select reads back later.
+ */
+template <typename T> void PatchMatcher::ChooseAll()
+{
+	auto size = _depth.size(); auto stream = GetStream(STREAM_VIEWS, 0); auto count = (int)_kernels.size();
+
+	_scores.clear();
+	for (auto view = 0; view < count; view++) _scores.push_back(Mat(size, HalfUtils::GetType<T>(1)));
+	_costs = Mat(size, HalfUtils::GetType<T>(1)); _views = Mat(size, CV_32SC1);
+	UpdatePeak(0);
+
+	ForRows(size.height, [&](const Range& range)
+	{
+		auto depthBuffer = vector<float>(size.width); auto normalBuffer = vector<Vec3f>(size.width);
+		auto scoreBuffer = vector<float>(size.width * count); auto costBuffer = vector<float>(size.width);
+		const float * scores[MAX_VIEWS]; float costs[MAX_VIEWS] = {};
+
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto depths = HalfUtils::ReadRow<T>(_depth, row, depthBuffer.data());
+			auto normals = (const Vec3f *)HalfUtils::ReadRow<T>(_normals, row, (float *)normalBuffer.data());
+
+			for (auto view = 0; view < count; view++)
+			{
+				auto buffer = &scoreBuffer[view * size.width]; auto target = HalfUtils::GetRowBuffer<T>(_scores[view], row, buffer);
+				for (auto column = 0; column < size.width; column++) target[column] = _kernels[view]->GetCost(column, row, depths[column], normals[column]);
+				HalfUtils::WriteRow<T>(_scores[view], row, target);
+				scores[view] = HalfUtils::ReadRow<T>(_scores[view], row, buffer);
+			}
+
+			auto means = HalfUtils::GetRowBuffer<T>(_costs, row, costBuffer.data()); auto views = _views.ptr<int>(row);
+			for (auto column = 0; column < size.width; column++)
+			{
+				auto rng = CounterRng(_settings.GetSeed(), stream, (uint64_t)row * size.width + column);
+				for (auto view = 0; view < count; view++) costs[view] = scores[view][column];
+
+				views[column] = ChooseViews(costs, rng);
+				means[column] = GetMean(costs, views[column]);
+			}
+			HalfUtils::WriteRow<T>(_costs, row, means);
+		}
+	});
+}
+
+/**
+ * @brief Keep track of the most memory that the maps of the run have held at once
+ * @param extra The bytes of maps that are held outside the members (such as the level that is being replaced)
+ * @remarks The maps are the hypotheses, costs, chosen views, per-view scores, changed flags and priors.
+ */
+void PatchMatcher::UpdatePeak(size_t extra)
+{
+	auto bytes = extra + HalfUtils::GetBytes(_depth) + HalfUtils::GetBytes(_normals) + HalfUtils::GetBytes(_costs) + HalfUtils::GetBytes(_views) + HalfUtils::GetBytes(_changed);
+	for (auto& score : _scores) bytes += HalfUtils::GetBytes(score);
+	for (auto i = 0; i < (int)_priorDepths.size(); i++) bytes += HalfUtils::GetBytes(_priorDepths[i]) + HalfUtils::GetBytes(_priorNormals[i]);
+	_peakBytes = max(_peakBytes, bytes);
+}
+
+/**
+ * @brief Build the random stream of a purpose at the current level
+ * @param purpose What the numbers are for (one of the STREAM_ constants)
+ * @param pass The pass of the iteration (0 when there is only one)
+ * @return uint32_t The purpose in the top 4 bits, the level in the next 8 and the pass in the last 20
+ */
+uint32_t PatchMatcher::GetStream(int purpose, int pass)
+{
+	return ((uint32_t)purpose << 28) | ((uint32_t)(_level & 0xFF) << 20) | ((uint32_t)pass & 0xFFFFF);
+}
+
+/**
+ * @brief Update the active pixels of one colour of the checkerboard
+ * @param iteration The number of the iteration
+ * @param colour The colour (0 or 1) of the pixels that are updated
+ * @remarks A pixel is marked as changed when its cost drops by more than CONVERGE_COST during its update. Each
+ * pixel draws from its own counter-based generator, so the result does not depend on the number of threads.
+ */
+template <typename T> void PatchMatcher::Iterate(int iteration, int colour)
+{
+	auto rows = _depth.rows; auto stream = GetStream(STREAM_PASS, iteration * 2 + colour);
+
+	ForRows(rows, [&](const Range& range)
+	{
+		for (auto row = range.start; row < range.end; row++)
+		{
+			auto changed = _changed.ptr<uchar>(row);
+
+			for (auto column : _work[row * 2 + colour])
+			{
+				auto rng = CounterRng(_settings.GetSeed(), stream, (uint64_t)row * _depth.cols + column);
+				Select<T>(column, row, rng); auto before = HalfUtils::Get<T>(_costs, column, row);
+				Propagate<T>(column, row);
+				Refine<T>(column, row, rng);
+				if (before - HalfUtils::Get<T>(_costs, column, row) > CONVERGE_COST) changed[column] = 1;
+			}
+		}
+	});
+}
+
+/**
+ * @brief Run a loop over the rows of the current level
+ * @param rows The number of rows
+ * @param body The work on a range of rows
+ * @remarks Without a thread count the rows go to the OpenCV pool. Otherwise they are split into that many bands,
+ * each on its own thread (the calling thread takes the first), so that several matchers can run side by side
+ * within a shared budget of threads. The first error of a band is rethrown once every band has finished.
+ */
+void PatchMatcher::ForRows(int rows, const function<void(const Range&)>& body)
+{
+	auto threads = min(_settings.GetThreads(), rows);
+	if (threads <= 0) { parallel_for_(Range(0, rows), body); return; }
+
+	auto errors = vector<exception_ptr>(threads); auto workers = vector<thread>();
+	auto run = [&](int band) { try { body(Range(band * rows / threads, (band + 1) * rows / threads)); } catch (...) { errors[band] = current_exception(); } };
+
+	for (auto band = 1; band < threads; band++) workers.push_back(thread(run, band));
+	run(0);
+	for (auto& worker : workers) worker.join();
+
+	for (auto& error : errors) if (error) rethrow_exception(error);
+}
+
+//--------------------------------------------------
+// Active Set
+//--------------------------------------------------
+
+/**
+ * @brief Make every pixel active (the start of a level)
+ * @return int The number of active pixels
+ */
+int PatchMatcher::ResetActive()
+{
+	_changed = Mat(_depth.size(), CV_8UC1, Scalar::all(0));
+	_work = vector<vector<int>>(_depth.rows * 2);
+
+	for (auto row = 0; row < _depth.rows; row++)
+	{
+		for (auto column = 0; column < _depth.cols; column++) _work[row * 2 + (row + column) % 2].push_back(column);
+	}
+
+	return (int)_depth.total();
+}
+
+/**
+ * @brief Rebuild the work lists from the pixels that changed during the last iteration
+ * @return int The number of active pixels
+ * @remarks A pixel stays active if it changed, or if a pixel that it propagates from changed, since that is the
+ * only way a converged pixel can be offered a better plane. The changed flags are cleared for the next iteration.
+ */
+int PatchMatcher::UpdateActive()
+{
+	auto result = 0;
+
+	for (auto row = 0; row < _depth.rows; row++)
+	{
+		_work[row * 2].clear(); _work[row * 2 + 1].clear();
+
+		for (auto column = 0; column < _depth.cols; column++)
+		{
+			auto active = _changed.at<uchar>(row, column) != 0;
+			for (auto i = 0; i < NEIGHBOUR_COUNT && !active; i++)
+			{
+				auto fromX = column + NEIGHBOURS[i][0]; auto fromY = row + NEIGHBOURS[i][1];
+				if (fromX < 0 || fromY < 0 || fromX >= _depth.cols || fromY >= _depth.rows) continue;
+				active = _changed.at<uchar>(fromY, fromX) != 0;
+			}
+
+			if (active) { _work[row * 2 + (row + column) % 2].push_back(column); result++; }
+		}
+	}
+
+	_changed.setTo(Scalar::all(0));
+	return result;
+}
+
+/**
+ * @brief Choose the views of a pixel for this pass
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param rng The random number generator of the pixel
+ * @remarks The current hypothesis is rescored against the views that were chosen last pass and RESCORE_COUNT
+ * others drawn at random. The other views keep the score they were last given (which may belong to an older
+ * hypothesis), and a view that is newly chosen on such a score is rescored before the mean is taken. A pass
+ * costs about k + RESCORE_COUNT + C * k kernel calls instead of N + C * k for C candidates, whatever N is.
+ */
+template <typename T> void PatchMatcher::Select(int x, int y, CounterRng& rng)
+{
+	auto depth = HalfUtils::Get<T>(_depth, x, y); auto normal = HalfUtils::GetVector<T>(_normals, x, y);
+	auto count = (int)_kernels.size(); auto& views = _views.at<int>(y, x);
+
+	auto fresh = 0; int others[MAX_VIEWS]; auto otherCount = 0;
+	for (auto view = 0; view < count; view++) if ((views & (1 << view)) != 0) fresh |= 1 << view; else others[otherCount++] = view;
+	for (auto i = 0; i < min(RESCORE_COUNT, otherCount); i++)
+	{
+		swap(others[i], others[rng.Uniform(i, otherCount)]); fresh |= 1 << others[i];
+	}
+
+	float costs[MAX_VIEWS] = {};
+	for (auto view = 0; view < count; view++)
+	{
+		if ((fresh & (1 << view)) != 0) HalfUtils::Set<T>(_scores[view], x, y, _kernels[view]->GetCost(x, y, depth, normal));
+		costs[view] = HalfUtils::Get<T>(_scores[view], x, y);
+	}
+
+	views = ChooseViews(costs, rng);
+	for (auto view = 0; view < count; view++)
+	{
+		if ((views & ~fresh & (1 << view)) == 0) continue;
+		HalfUtils::Set<T>(_scores[view], x, y, _kernels[view]->GetCost(x, y, depth, normal)); costs[view] = HalfUtils::Get<T>(_scores[view], x, y);
+	}
+
+	HalfUtils::Set<T>(_costs, x, y, GetMean(costs, views));
+}
+
+/**
+ * @brief Test the planes of the neighbours (and of the other views) at a pixel
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @remarks The candidates are gathered first and scored as one batch, so that the kernel can score them together.
+ */
+template <typename T> void PatchMatcher::Propagate(int x, int y)
+{
+	vector<float> depths; vector<Vec3f> normals;
+	depths.reserve(NEIGHBOUR_COUNT + _priorDepths.size()); normals.reserve(NEIGHBOUR_COUNT + _priorDepths.size());
+
+	for (auto i = 0; i < NEIGHBOUR_COUNT; i++)
+	{
+		auto fromX = x + NEIGHBOURS[i][0]; auto fromY = y + NEIGHBOURS[i][1];
+		if (fromX < 0 || fromY < 0 || fromX >= _depth.cols || fromY >= _depth.rows) continue;
+
+		auto depth = GetPlaneDepth<T>(x, y, fromX, fromY);
+		if (depth > 0) { depths.push_back(depth); normals.push_back(HalfUtils::GetVector<T>(_normals, fromX, fromY)); }
+	}
+
+	for (auto i = 0; _level == 0 && i < (int)_priorDepths.size(); i++)
+	{
+		auto depth = HalfUtils::Get<T>(_priorDepths[i], x, y);
+		if (depth > 0) { depths.push_back(depth); normals.push_back(HalfUtils::GetVector<T>(_priorNormals[i], x, y)); }
+	}
+
+	Test<T>(x, y, (int)depths.size(), depths.data(), normals.data());
+}
+
+/**
+ * @brief Test random perturbations of the hypothesis at a pixel, halving the search range each step
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param rng The random number generator of the pixel
+ */
+template <typename T> void PatchMatcher::Refine(int x, int y, CounterRng& rng)
+{
+	auto depthRange = (float)(_settings.GetMaxDepth() - _settings.GetMinDepth()) * 0.5f * _refineScale; auto normalRange = 0.5f * _refineScale;
+
+	for (auto step = 0; step < _settings.GetRefineSteps(); step++)
+	{
+		auto depth = HalfUtils::Get<T>(_depth, x, y); auto normal = HalfUtils::GetVector<T>(_normals, x, y);
+
+		auto newDepth = depth + rng.Uniform(-depthRange, depthRange);
+		auto offset = Vec3f(rng.Uniform(-normalRange, normalRange), rng.Uniform(-normalRange, normalRange), rng.Uniform(-normalRange, normalRange));
+		auto newNormal = normalize(normal + offset);
+
+		float depths[REFINE_COUNT] = { newDepth, depth, newDepth };
+		Vec3f normals[REFINE_COUNT] = { normal, newNormal, newNormal };
+		Test<T>(x, y, REFINE_COUNT, depths, normals);
+
+		depthRange *= 0.5f; normalRange *= 0.5f;
+	}
+}
+
+//--------------------------------------------------
+// Hypotheses
+//--------------------------------------------------
+
+/**
+ * @brief Score a batch of hypotheses at a pixel and keep the best if it is better than the current one
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param count The number of hypotheses
+ * @param depths The depth of each hypothesis
+ * @param normals The normal of each hypothesis
+ * @return true If a hypothesis was kept
+ * @return false If they were all out of range, faced away from the camera, or scored worse
+ * @remarks Hypotheses outside the depth range are dropped before scoring. Ties go to the earlier hypothesis. The
+ * cost to beat is kept in single precision while the batch is scored, and only rounded when it is stored.
+ */
+template <typename T> bool PatchMatcher::Test(int x, int y, int count, const float * depths, const Vec3f * normals)
+{
+	float candidateDepths[KERNEL_LANES]; Vec3f candidateNormals[KERNEL_LANES]; float costs[KERNEL_LANES];
+	auto current = HalfUtils::Get<T>(_costs, x, y); auto result = false;
+
+	for (auto first = 0; first < count; first += KERNEL_LANES)
+	{
+		auto candidates = 0;
+		for (auto i = first; i < min(count, first + KERNEL_LANES); i++)
+		{
+			if (depths[i] < _settings.GetMinDepth() || depths[i] > _settings.GetMaxDepth()) continue;
+			candidateDepths[candidates] = depths[i]; candidateNormals[candidates] = normals[i]; candidates++;
+		}
+		if (candidates == 0) continue;
+
+		Score(x, y, candidates, candidateDepths, candidateNormals, costs);
+
+		for (auto i = 0; i < candidates; i++)
+		{
+			if (costs[i] >= current) continue;
+			current = costs[i]; HalfUtils::Set<T>(_depth, x, y, candidateDepths[i]); HalfUtils::SetVector<T>(_normals, x, y, candidateNormals[i]);
+			result = true;
+		}
+	}
+
+	if (result) HalfUtils::Set<T>(_costs, x, y, current);
+	return result;
+}
+
+/**
+ * @brief Find the depth at a pixel of the plane that belongs to another pixel
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param fromX The x coordinate of the pixel whose plane we are using
+ * @param fromY The y coordinate of the pixel whose plane we are using
+ * @return float The depth (-1 if the ray of the pixel does not meet the plane in front of the camera)
+ */
+template <typename T> float PatchMatcher::GetPlaneDepth(int x, int y, int fromX, int fromY)
+{
+	auto normal = HalfUtils::GetVector<T>(_normals, fromX, fromY);
+	auto normal64 = Vec3d(normal[0], normal[1], normal[2]);
+
+	auto point = _pairs[0]->GetRay(fromX, fromY) * (double)HalfUtils::Get<T>(_depth, fromX, fromY);
+	auto denominator = normal64.dot(_pairs[0]->GetRay(x, y));
+	if (denominator >= 0) return -1;
+
+	return (float)(normal64.dot(point) / denominator);
+}
+
+//--------------------------------------------------
+// View Selection
+//--------------------------------------------------
+
+/**
+ * @brief Score hypotheses against the views that were chosen for a pixel
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @param count The number of hypotheses (at most KERNEL_LANES)
+ * @param depths The depth of each hypothesis
+ * @param normals The normal of each hypothesis
+ * @param costs The resultant costs (the mean over the chosen views)
+ */
+void PatchMatcher::Score(int x, int y, int count, const float * depths, const Vec3f * normals, float * costs)
+{
+	float viewCosts[KERNEL_LANES]; auto views = _views.at<int>(y, x); auto selected = 0;
+	for (auto i = 0; i < count; i++) costs[i] = 0;
+
+	for (auto view = 0; view < (int)_kernels.size(); view++)
+	{
+		if ((views & (1 << view)) == 0) continue;
+
+		_kernels[view]->GetCosts(x, y, count, depths, normals, viewCosts);
+		for (auto i = 0; i < count; i++) costs[i] += viewCosts[i];
+		selected++;
+	}
+
+	for (auto i = 0; i < count; i++) costs[i] = selected == 0 ? PMATCH_MAX_COST : costs[i] / selected;
+}
+
+/**
+ * @brief Choose the views that a pixel is scored against
+ * @param costs The cost of the current hypothesis in each view
+ * @param rng The random number generator that is used to sample views
+ * @return int A bit mask of the chosen views
+ * @remarks SELECT_TOP_K takes the views with the lowest costs. SELECT_SAMPLE draws views without replacement, with
+ * a weight of exp(-cost^2 / 2 sigma^2), so occluded views are rarely drawn but are not ruled out for good. It falls
+ * back to the top views when no view has any weight.
+ */
+int PatchMatcher::ChooseViews(const float * costs, CounterRng& rng)
+{
+	auto count = (int)_kernels.size(); auto result = 0;
+
+	if (_settings.GetSelection() == SELECT_SAMPLE)
+	{
+		float weights[MAX_VIEWS]; auto total = 0.0f;
+		for (auto view = 0; view < count; view++)
+		{
+			weights[view] = costs[view] >= PMATCH_MAX_COST ? 0.0f : exp(-costs[view] * costs[view] / (2 * SAMPLE_SIGMA * SAMPLE_SIGMA));
+			total += weights[view];
+		}
+
+		for (auto draw = 0; draw < _settings.GetViewCount() && total > 1e-6f; draw++)
+		{
+			auto target = rng.Uniform(0.0f, total); auto chosen = -1;
+			for (auto view = 0; view < count; view++)
+			{
+				if (weights[view] <= 0) continue;
+				chosen = view; target -= weights[view]; if (target <= 0) break;
+			}
+
+			result |= 1 << chosen; total -= weights[chosen]; weights[chosen] = 0;
+		}
+
+		if (result != 0) return result;
+	}
+
+	int order[MAX_VIEWS]; for (auto view = 0; view < count; view++) order[view] = view;
+	partial_sort(order, order + _settings.GetViewCount(), order + count, [costs](int a, int b) { return costs[a] < costs[b]; });
+	for (auto i = 0; i < _settings.GetViewCount(); i++) result |= 1 << order[i];
+
+	return result;
+}
+
+/**
+ * @brief Find the mean cost over the chosen views
+ * @param costs The cost in each view
+ * @param views A bit mask of the chosen views
+ * @return float The resultant cost
+ */
+float PatchMatcher::GetMean(const float * costs, int views)
+{
+	auto total = 0.0f; auto selected = 0;
+
+	for (auto view = 0; view < (int)_kernels.size(); view++)
+	{
+		if ((views & (1 << view)) == 0) continue;
+		total += costs[view]; selected++;
+	}
+
+	return selected == 0 ? PMATCH_MAX_COST : total / selected;
+}
@@ -0,0 +1,97 @@
+//--------------------------------------------------
+// Engine: Multi-view PatchMatch stereo that finds a depth and normal for each reference pixel
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <iostream>
+#include <exception>
+#include <algorithm>
+#include <functional>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Calibration.h"
+#include "Frame.h"
+#include "ViewPair.h"
+#include "CostKernel.h"
+#include "MatchSettings.h"
+#include "PMatchUtils.h"
+#include "CounterRng.h"
+#include "HalfUtils.h"
+
+namespace NVL_App
+{
+	class PatchMatcher
+	{
+	private:
+		Mat _camera;
+		Frame * _reference;
+		vector<Frame *> _sources;
+		int _level;
+		float _refineScale;
+		vector<ViewPair *> _pairs;
+		vector<CostKernel *> _kernels;
+		MatchSettings _settings;
+		Mat _depth;
+		Mat _normals;
+		Mat _costs;
+		Mat _views;
+		vector<Mat> _scores;
+		Mat _changed;
+		vector<vector<int>> _work;
+		int _passes;
+		size_t _updates;
+		size_t _peakBytes;
+		vector<Mat> _priorDepths;
+		vector<Mat> _priorNormals;
+	public:
+		PatchMatcher(Calibration * calibration, Frame * reference, vector<Frame *>& sources, MatchSettings& settings);
+		~PatchMatcher();
+
+		void AddPrior(Mat& depth, Mat& normals);
+		void Run();
+
+		Mat GetConfidence();
+
+		inline Mat& GetDepth() { return _depth; }
+		inline Mat& GetNormals() { return _normals; }
+		inline Mat& GetCosts() { return _costs; }
+		inline Mat& GetViews() { return _views; }
+		inline int& GetLevel() { return _level; }
+		inline int& GetPasses() { return _passes; }
+		inline size_t& GetUpdates() { return _updates; }
+		inline size_t& GetPeakBytes() { return _peakBytes; }
+		inline vector<CostKernel *>& GetKernels() { return _kernels; }
+	private:
+		int GetLevelCount();
+		void BuildLevel(int level);
+		void ReleaseLevel();
+		template <typename T> void RunLevels();
+		template <typename T> void Initialize();
+		template <typename T> void Upsample();
+		template <typename T> void ChooseAll();
+		void UpdatePeak(size_t extra);
+		uint32_t GetStream(int purpose, int pass);
+		int ResetActive();
+		int UpdateActive();
+		template <typename T> void Iterate(int iteration, int colour);
+		void ForRows(int rows, const function<void(const Range&)>& body);
+		template <typename T> void Select(int x, int y, CounterRng& rng);
+		template <typename T> void Propagate(int x, int y);
+		template <typename T> void Refine(int x, int y, CounterRng& rng);
+		template <typename T> bool Test(int x, int y, int count, const float * depths, const Vec3f * normals);
+		void Score(int x, int y, int count, const float * depths, const Vec3f * normals, float * costs);
+		int ChooseViews(const float * costs, CounterRng& rng);
+		float GetMean(const float * costs, int views);
+		template <typename T> float GetPlaneDepth(int x, int y, int fromX, int fromY);
+	};
+}
@@ -0,0 +1,184 @@
+//--------------------------------------------------
+// Implementation of class TiledMatcher
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "TiledMatcher.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define SOURCE_MARGIN 8
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param calibration The calibration of the camera (the frames are assumed to be undistorted)
+ * @param reference The frame that the depth map is found for
+ * @param sources The frames that the reference is matched against
+ * @param settings The settings of each tile's run
+ * @param tileSize The width and height of the part of a tile that is kept
+ * @param halo The number of extra pixels that each tile is matched with on every side (and then discarded)
+ */
+TiledMatcher::TiledMatcher(Calibration * calibration, Frame * reference, vector<Frame *>& sources, MatchSettings& settings, int tileSize, int halo) :
+	_calibration(calibration), _reference(reference), _sources(sources), _settings(settings), _tileSize(tileSize), _halo(max(halo, 0)), _tileCount(0), _updates(0), _sourcePixels(0)
+{
+	if (tileSize <= 0) throw runtime_error("The tile size must be positive");
+}
+
+//--------------------------------------------------
+// Execution
+//--------------------------------------------------
+
+/**
+ * @brief Add the hypotheses of another view (see PatchMatcher::AddPrior)
+ * @param depth The depth of each reference pixel (0 where there is no hypothesis)
+ * @param normals The normal of each reference pixel
+ */
+void TiledMatcher::AddPrior(Mat& depth, Mat& normals)
+{
+	_priorDepths.push_back(depth); _priorNormals.push_back(normals);
+}
+
+/**
+ * @brief Find the depth map one tile at a time, stitching the cores of the tiles together
+ * @remarks Only one tile is matched at a time. Its pyramids, kernels and cost maps are released before the next tile
+ * starts, so these scale with the tile rather than the image. The source crops are views of the source images, which
+ * the caller keeps loaded in full, along with the full size depth, normal and cost maps of the result.
+ */
+void TiledMatcher::Run()
+{
+	auto size = _reference->GetSize();
+	_depth = Mat(size, CV_32FC1, Scalar::all(0));
+	_normals = Mat(size, CV_32FC3, Scalar(0, 0, -1));
+	_costs = Mat(size, CV_32FC1, Scalar::all(PMATCH_MAX_COST));
+	_updates = 0; _sourcePixels = 0;
+
+	auto tiles = GetTiles(size, _tileSize); _tileCount = (int)tiles.size();
+	for (auto i = 0; i < (int)tiles.size(); i++) RunTile(i, tiles[i]);
+}
+
+/**
+ * @brief Build the confidence of each pixel from its cost
+ * @return Mat A CV_32F map in [0, 1]
+ */
+Mat TiledMatcher::GetConfidence()
+{
+	return PMatchUtils::GetConfidence(_costs);
+}
+
+//--------------------------------------------------
+// Tiles
+//--------------------------------------------------
+
+/**
+ * @brief Split an image into tiles that cover it without overlapping
+ * @param size The size of the image
+ * @param tileSize The width and height of a tile (the tiles along the right and bottom edges may be smaller)
+ * @return vector<Rect> The tiles, in row major order
+ */
+vector<Rect> TiledMatcher::GetTiles(const Size& size, int tileSize)
+{
+	auto result = vector<Rect>();
+
+	for (auto y = 0; y < size.height; y += tileSize)
+	{
+		for (auto x = 0; x < size.width; x += tileSize) result.push_back(Rect(x, y, min(tileSize, size.width - x), min(tileSize, size.height - y)));
+	}
+
+	return result;
+}
+
+/**
+ * @brief Match one tile and copy its core into the result
+ * @param index The index of the tile (it offsets the seed, so that tiles do not repeat each other's numbers)
+ * @param core The part of the reference that the tile keeps
+ */
+void TiledMatcher::RunTile(int index, const Rect& core)
+{
+	auto region = Rect(core.x - _halo, core.y - _halo, core.width + 2 * _halo, core.height + 2 * _halo) & Rect(Point(0, 0), _reference->GetSize());
+
+	Mat referenceImage = _reference->GetImage()(region);
+	auto reference = Frame(_reference->GetId(), referenceImage, _reference->GetPose());
+	reference.GetOffset() = _reference->GetOffset() + region.tl();
+
+	vector<Frame> crops; crops.reserve(_sources.size());
+	for (auto source : _sources)
+	{
+		auto sourceRegion = GetSourceRegion(source, region);
+		if (sourceRegion.width < 2 || sourceRegion.height < 2) continue;
+
+		Mat sourceImage = source->GetImage()(sourceRegion);
+		crops.push_back(Frame(source->GetId(), sourceImage, source->GetPose()));
+		crops.back().GetOffset() = source->GetOffset() + sourceRegion.tl();
+		_sourcePixels += sourceRegion.area();
+	}
+	if (crops.empty()) return;
+
+	auto sources = vector<Frame *>(); for (auto& crop : crops) sources.push_back(&crop);
+	auto settings = _settings; settings.GetSeed() += index;
+
+	auto matcher = PatchMatcher(_calibration, &reference, sources, settings);
+	for (auto i = 0; i < (int)_priorDepths.size(); i++)
+	{
+		Mat depth = _priorDepths[i](region); Mat normals = _priorNormals[i](region);
+		matcher.AddPrior(depth, normals);
+	}
+	matcher.Run();
+
+	auto local = Rect(core.tl() - region.tl(), core.size());
+	Mat depth = _depth(core); Mat normals = _normals(core); Mat costs = _costs(core);
+	matcher.GetDepth()(local).copyTo(depth);
+	matcher.GetNormals()(local).copyTo(normals);
+	matcher.GetCosts()(local).copyTo(costs);
+	_updates += matcher.GetUpdates();
+}
+
+/**
+ * @brief Find the part of a source image that a region of the reference can match against
+ * @param source The source frame
+ * @param region The region of the reference
+ * @return Rect The region of the source (empty if the region cannot be seen)
+ * @remarks The rays through the region, between the smallest and largest depth, form a convex solid. It projects
+ * into the convex hull of its 8 corners, which is padded by the matching window (and a margin for slanted planes).
+ * If any corner is behind the source camera the whole source is used.
+ */
+Rect TiledMatcher::GetSourceRegion(Frame * source, const Rect& region)
+{
+	Mat pose = PMatchUtils::GetRelativePose(_reference->GetPose(), source->GetPose());
+	Mat camera = PMatchUtils::CropCamera(_calibration->GetCamera(), _reference->GetOffset());
+	Mat sourceCamera = PMatchUtils::CropCamera(_calibration->GetCamera(), source->GetOffset());
+	auto pair = ViewPair(camera, sourceCamera, source->GetImage(), source->GetImage(), pose);
+
+	auto full = Rect(Point(0, 0), source->GetSize());
+	auto minX = DBL_MAX, minY = DBL_MAX, maxX = -DBL_MAX, maxY = -DBL_MAX;
+
+	for (auto corner = 0; corner < 8; corner++)
+	{
+		auto x = (corner & 1) ? region.x + region.width - 1 : region.x; auto y = (corner & 2) ? region.y + region.height - 1 : region.y;
+		auto depth = (corner & 4) ? _settings.GetMaxDepth() : _settings.GetMinDepth();
+
+		auto point = pair.GetRotation() * (pair.GetRay(x, y) * depth) + pair.GetTranslation();
+		if (point[2] <= 0) return full;
+
+		auto pixel = pair.GetSourceCamera() * point;
+		auto u = pixel[0] / pixel[2], v = pixel[1] / pixel[2];
+		minX = min(minX, u); minY = min(minY, v); maxX = max(maxX, u); maxY = max(maxY, v);
+	}
+
+	auto pad = 2 * _settings.GetWindow() + SOURCE_MARGIN;
+	auto left = max(minX - pad, -1.0); auto top = max(minY - pad, -1.0);
+	auto right = min(maxX + pad, (double)full.width); auto bottom = min(maxY + pad, (double)full.height);
+	if (right <= left || bottom <= top) return Rect();
+
+	auto result = Rect(Point((int)floor(left), (int)floor(top)), Point((int)ceil(right) + 1, (int)ceil(bottom) + 1));
+	return result & full;
+}
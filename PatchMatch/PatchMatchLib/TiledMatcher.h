@@ -0,0 +1,64 @@
+//--------------------------------------------------
+// Engine: Runs PatchMatch over overlapping tiles of the reference, so that the matching state is set by the tile size
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cfloat>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Calibration.h"
+#include "Frame.h"
+#include "ViewPair.h"
+#include "MatchSettings.h"
+#include "PMatchUtils.h"
+#include "PatchMatcher.h"
+
+namespace NVL_App
+{
+	class TiledMatcher
+	{
+	private:
+		Calibration * _calibration;
+		Frame * _reference;
+		vector<Frame *> _sources;
+		MatchSettings _settings;
+		int _tileSize;
+		int _halo;
+		Mat _depth;
+		Mat _normals;
+		Mat _costs;
+		vector<Mat> _priorDepths;
+		vector<Mat> _priorNormals;
+		int _tileCount;
+		size_t _updates;
+		size_t _sourcePixels;
+	public:
+		TiledMatcher(Calibration * calibration, Frame * reference, vector<Frame *>& sources, MatchSettings& settings, int tileSize, int halo);
+
+		void AddPrior(Mat& depth, Mat& normals);
+		void Run();
+
+		Mat GetConfidence();
+		Rect GetSourceRegion(Frame * source, const Rect& region);
+		static vector<Rect> GetTiles(const Size& size, int tileSize);
+
+		inline Mat& GetDepth() { return _depth; }
+		inline Mat& GetNormals() { return _normals; }
+		inline Mat& GetCosts() { return _costs; }
+		inline int& GetTileCount() { return _tileCount; }
+		inline size_t& GetUpdates() { return _updates; }
+		inline size_t& GetSourcePixels() { return _sourcePixels; }
+	private:
+		void RunTile(int index, const Rect& core);
+	};
+}
@@ -0,0 +1,91 @@
+//--------------------------------------------------
+// Implementation of class ViewPair
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ViewPair.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param camera The camera matrix (shared by both images)
+ * @param reference The grayscale (CV_32F) reference image
+ * @param source The grayscale (CV_32F) source image
+ * @param pose The 4x4 transform from the reference camera to the source camera
+ */
+ViewPair::ViewPair(Mat& camera, Mat& reference, Mat& source, Mat& pose) : ViewPair(camera, camera, reference, source, pose)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Constructor for images with different camera matrices
+ * @param camera The camera matrix of the reference image
+ * @param sourceCamera The camera matrix of the source image
+ * @param reference The grayscale (CV_32F) reference image
+ * @param source The grayscale (CV_32F) source image
+ * @param pose The 4x4 transform from the reference camera to the source camera
+ * @remarks Crops of the same camera only differ in their principal points, so this is how tiles are matched.
+ */
+ViewPair::ViewPair(Mat& camera, Mat& sourceCamera, Mat& reference, Mat& source, Mat& pose) : _reference(reference), _source(source)
+{
+	Mat camera64; camera.convertTo(camera64, CV_64F);
+	Mat sourceCamera64; sourceCamera.convertTo(sourceCamera64, CV_64F);
+	Mat pose64; pose.convertTo(pose64, CV_64F);
+
+	for (auto row = 0; row < 3; row++)
+	{
+		for (auto column = 0; column < 3; column++)
+		{
+			_camera(row, column) = camera64.at<double>(row, column);
+			_sourceCamera(row, column) = sourceCamera64.at<double>(row, column);
+			_rotation(row, column) = pose64.at<double>(row, column);
+		}
+		_translation[row] = pose64.at<double>(row, 3);
+	}
+
+	_cameraInverse = _camera.inv();
+}
+
+//--------------------------------------------------
+// Geometry
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the ray through a reference pixel (scaled so that its depth is 1)
+ * @param x The x coordinate of the pixel
+ * @param y The y coordinate of the pixel
+ * @return Vec3d The resultant ray
+ */
+Vec3d ViewPair::GetRay(double x, double y)
+{
+	return _cameraInverse * Vec3d(x, y, 1);
+}
+
+/**
+ * @brief Retrieve the homography that a plane induces between the reference and source images
+ * @param point A point on the plane (in reference camera coordinates)
+ * @param normal The normal of the plane (in reference camera coordinates)
+ * @return Matx33d The homography that maps reference pixels to source pixels
+ * @remarks For the plane n.X = n.P the source point is R X + t = (R + t n^T / n.P) X, so the homography is
+ * Ks (R + t n^T / n.P) K^-1.
+ */
+Matx33d ViewPair::GetHomography(const Vec3d& point, const Vec3d& normal)
+{
+	auto distance = normal.dot(point);
+
+	auto plane = _rotation;
+	for (auto row = 0; row < 3; row++)
+	{
+		for (auto column = 0; column < 3; column++) plane(row, column) += _translation[row] * normal[column] / distance;
+	}
+
+	return _sourceCamera * plane * _cameraInverse;
+}
@@ -0,0 +1,43 @@
+//--------------------------------------------------
+// Model: A reference image and a source image, with the geometry that relates them
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_App
+{
+	class ViewPair
+	{
+	private:
+		Mat _reference;
+		Mat _source;
+		Matx33d _camera;
+		Matx33d _cameraInverse;
+		Matx33d _sourceCamera;
+		Matx33d _rotation;
+		Vec3d _translation;
+	public:
+		ViewPair(Mat& camera, Mat& reference, Mat& source, Mat& pose);
+		ViewPair(Mat& camera, Mat& sourceCamera, Mat& reference, Mat& source, Mat& pose);
+
+		Vec3d GetRay(double x, double y);
+		Matx33d GetHomography(const Vec3d& point, const Vec3d& normal);
+
+		inline Mat& GetReference() { return _reference; }
+		inline Mat& GetSource() { return _source; }
+		inline Matx33d& GetCamera() { return _camera; }
+		inline Matx33d& GetSourceCamera() { return _sourceCamera; }
+		inline Matx33d& GetRotation() { return _rotation; }
+		inline Vec3d& GetTranslation() { return _translation; }
+	};
+}
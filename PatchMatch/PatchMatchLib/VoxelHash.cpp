@@ -0,0 +1,217 @@
+//--------------------------------------------------
+// Implementation of class VoxelHash
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "VoxelHash.h"
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param voxelSize The width of a voxel (in world units)
+ */
+VoxelHash::VoxelHash(double voxelSize) : _voxelSize(voxelSize)
+{
+	if (voxelSize <= 0) throw runtime_error("The voxel size must be positive");
+	_shards = new Shard[VOXEL_SHARDS];
+}
+
+/**
+ * @brief Main Terminator
+ */
+VoxelHash::~VoxelHash()
+{
+	delete[] _shards;
+}
+
+//--------------------------------------------------
+// Insertion
+//--------------------------------------------------
+
+/**
+ * @brief Merge a point into the voxel that contains it
+ * @param point The point (in world coordinates)
+ * @param colour The colour of the point
+ */
+void VoxelHash::Add(const Vec3d& point, const Vec3b& colour)
+{
+	auto key = GetKey(point); auto& shard = _shards[GetShard(key)];
+
+	auto guard = unique_lock<mutex>(shard.lock);
+	Merge(shard.voxels[key], point, colour);
+}
+
+/**
+ * @brief Merge a batch of points into their voxels
+ * @param points The points (in world coordinates)
+ * @param colours The colour of each point
+ * @remarks The batch is grouped by shard first, so each shard is locked once per batch rather than once per point.
+ */
+void VoxelHash::Add(const vector<Vec3d>& points, const vector<Vec3b>& colours)
+{
+	if (points.size() != colours.size()) throw runtime_error("Each point must have a colour");
+
+	auto keys = vector<Key>(points.size());
+	auto groups = vector<vector<int>>(VOXEL_SHARDS);
+	for (auto i = 0; i < (int)points.size(); i++) { keys[i] = GetKey(points[i]); groups[GetShard(keys[i])].push_back(i); }
+
+	for (auto index = 0; index < VOXEL_SHARDS; index++)
+	{
+		if (groups[index].empty()) continue;
+
+		auto& shard = _shards[index];
+		auto guard = unique_lock<mutex>(shard.lock);
+		for (auto i : groups[index]) Merge(shard.voxels[keys[i]], points[i], colours[i]);
+	}
+}
+
+/**
+ * @brief Remove all the voxels
+ */
+void VoxelHash::Clear()
+{
+	for (auto index = 0; index < VOXEL_SHARDS; index++)
+	{
+		auto guard = unique_lock<mutex>(_shards[index].lock);
+		_shards[index].voxels.clear();
+	}
+}
+
+//--------------------------------------------------
+// Retrieval
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the number of occupied voxels
+ * @return size_t The resultant count
+ */
+size_t VoxelHash::GetCount()
+{
+	size_t result = 0;
+
+	for (auto index = 0; index < VOXEL_SHARDS; index++)
+	{
+		auto guard = unique_lock<mutex>(_shards[index].lock);
+		result += _shards[index].voxels.size();
+	}
+
+	return result;
+}
+
+/**
+ * @brief Retrieve the mean point and colour of each voxel
+ * @param points The resultant points
+ * @param colours The resultant colours
+ */
+void VoxelHash::GetPoints(vector<Vec3f>& points, vector<Vec3b>& colours)
+{
+	points.clear(); colours.clear();
+
+	for (auto index = 0; index < VOXEL_SHARDS; index++)
+	{
+		auto guard = unique_lock<mutex>(_shards[index].lock);
+		for (auto& entry : _shards[index].voxels)
+		{
+			auto& voxel = entry.second; auto scale = 1.0 / voxel.count;
+			points.push_back(Vec3f((float)(voxel.position[0] * scale), (float)(voxel.position[1] * scale), (float)(voxel.position[2] * scale)));
+			colours.push_back(Vec3b(saturate_cast<uchar>(voxel.colour[0] * scale), saturate_cast<uchar>(voxel.colour[1] * scale), saturate_cast<uchar>(voxel.colour[2] * scale)));
+		}
+	}
+}
+
+/**
+ * @brief Save the voxels as a binary PLY point cloud
+ * @param path The path of the file
+ * @remarks Each vertex is three floats and an RGB colour, written in the byte order of the host, which the header
+ * declares as little endian (the byte order of every platform that we build for).
+ */
+void VoxelHash::Save(const string& path)
+{
+	vector<Vec3f> points; vector<Vec3b> colours; GetPoints(points, colours);
+
+	auto writer = ofstream(path, ios::binary);
+	if (!writer.is_open()) throw runtime_error("Unable to open: " + path);
+
+	writer << "ply\n" << "format binary_little_endian 1.0\n" << "element vertex " << points.size() << "\n";
+	writer << "property float x\n" << "property float y\n" << "property float z\n";
+	writer << "property uchar red\n" << "property uchar green\n" << "property uchar blue\n" << "end_header\n";
+
+	for (auto i = 0; i < (int)points.size(); i++)
+	{
+		uchar colour[3] = { colours[i][2], colours[i][1], colours[i][0] };
+		writer.write((const char *)&points[i][0], 3 * sizeof(float));
+		writer.write((const char *)colour, 3);
+	}
+
+	if (!writer.good()) throw runtime_error("Unable to write: " + path);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find the key of the voxel that contains a point
+ * @param point The point
+ * @return Key The full indices of the voxel (so voxels only merge when all three indices match)
+ */
+VoxelHash::Key VoxelHash::GetKey(const Vec3d& point)
+{
+	return Key { (int64_t)floor(point[0] / _voxelSize), (int64_t)floor(point[1] / _voxelSize), (int64_t)floor(point[2] / _voxelSize) };
+}
+
+/**
+ * @brief Hash the indices of a voxel
+ * @param key The key of the voxel
+ * @return uint64_t The resultant hash
+ * @remarks Each index is folded into the running hash and mixed again, so the order of the indices matters and
+ * neighbouring voxels land far apart.
+ */
+uint64_t VoxelHash::GetHash(const Key& key)
+{
+	auto result = Mix((uint64_t)key.x);
+	result = Mix(result ^ (uint64_t)key.y);
+	return Mix(result ^ (uint64_t)key.z);
+}
+
+/**
+ * @brief Mix a value with the splitmix64 step
+ * @param value The value being mixed
+ * @return uint64_t The mixed value
+ */
+uint64_t VoxelHash::Mix(uint64_t value)
+{
+	value += 0x9E3779B97F4A7C15ull;
+	value ^= value >> 30; value *= 0xBF58476D1CE4E5B9ull;
+	value ^= value >> 27; value *= 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
+
+/**
+ * @brief Find the shard that a voxel belongs to
+ * @param key The key of the voxel
+ * @return int The index of the shard
+ * @remarks The shard comes from the top bits of the hash, while the map of the shard buckets on the low bits.
+ */
+int VoxelHash::GetShard(const Key& key)
+{
+	return (int)(GetHash(key) >> 58) % VOXEL_SHARDS;
+}
+
+/**
+ * @brief Add a point to the running sums of a voxel
+ * @param voxel The voxel (a new voxel is value initialized, so its sums start at zero)
+ * @param point The point
+ * @param colour The colour of the point
+ */
+void VoxelHash::Merge(Voxel& voxel, const Vec3d& point, const Vec3b& colour)
+{
+	voxel.position += point; voxel.colour += Vec3d(colour[0], colour[1], colour[2]); voxel.count++;
+}
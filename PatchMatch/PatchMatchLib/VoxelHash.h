@@ -0,0 +1,78 @@
+//--------------------------------------------------
+// Utility: A concurrent voxel hash that merges points into voxels (sharded, so threads rarely share a lock)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define VOXEL_SHARDS 64
+
+namespace NVL_App
+{
+	class VoxelHash
+	{
+	private:
+		struct Key
+		{
+			int64_t x, y, z;
+			bool operator==(const Key& other) const { return x == other.x && y == other.y && z == other.z; }
+		};
+
+		struct KeyHash
+		{
+			size_t operator()(const Key& key) const { return (size_t)GetHash(key); }
+		};
+
+		struct Voxel
+		{
+			Vec3d position;
+			Vec3d colour;
+			int count;
+		};
+
+		struct Shard
+		{
+			mutex lock;
+			unordered_map<Key, Voxel, KeyHash> voxels;
+		};
+
+		double _voxelSize;
+		Shard * _shards;
+	public:
+		VoxelHash(double voxelSize);
+		~VoxelHash();
+
+		void Add(const Vec3d& point, const Vec3b& colour);
+		void Add(const vector<Vec3d>& points, const vector<Vec3b>& colours);
+		void Clear();
+
+		size_t GetCount();
+		void GetPoints(vector<Vec3f>& points, vector<Vec3b>& colours);
+		void Save(const string& path);
+
+		inline double& GetVoxelSize() { return _voxelSize; }
+	private:
+		Key GetKey(const Vec3d& point);
+		static uint64_t GetHash(const Key& key);
+		static uint64_t Mix(uint64_t value);
+		static int GetShard(const Key& key);
+		static void Merge(Voxel& voxel, const Vec3d& point, const Vec3b& colour);
+	};
+}
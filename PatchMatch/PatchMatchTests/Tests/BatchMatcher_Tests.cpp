@@ -0,0 +1,107 @@
+//--------------------------------------------------
+// Unit Tests for the sequence batch matcher
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/BatchMatcher.h>
+using namespace NVL_App;
+
+#include "SceneUtils.h"
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that every frame of a sequence is matched, in order, with each frame loaded once
+ */
+TEST(BatchMatcher_Test, match_sequence)
+{
+	// Setup
+	auto size = Size(80, 60);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+	auto settings = MatchSettings(1.0, 10.0, 3, 4, 4);
+	settings.GetViewCount() = 2;
+
+	auto ids = vector<int> { 0, 1, 2, 3, 4 }; auto loads = 0;
+	auto loader = [&size, &loads](int id) { loads++; return SceneUtils::BuildFrame(id, size); };
+	auto window = FrameWindow(ids, loader, BatchMatcher::GetCapacity(1, 2, 2));
+	auto matcher = BatchMatcher(&calibration, &window, settings, 1, 2, 2);
+
+	// Execute
+	auto order = vector<int>(); auto good = vector<double>();
+	matcher.Run([&](Frame * reference, PatchMatcher * result)
+	{
+		auto total = 0; auto count = SceneUtils::CountGood(result->GetDepth(), 4.0f, total);
+		order.push_back(reference->GetId()); good.push_back((double)count / total);
+	});
+
+	// Confirm
+	ASSERT_EQ(order, ids);
+	ASSERT_EQ(loads, (int)ids.size());
+	ASSERT_EQ(matcher.GetReferences(), (int)ids.size());
+	ASSERT_GT(matcher.GetFramesPerMinute(), 0.0);
+	for (auto fraction : good) ASSERT_GT(fraction, 0.9);
+}
+
+/**
+ * @brief Confirm that the results do not depend on how many references run at once, or how the threads are shared
+ */
+TEST(BatchMatcher_Test, concurrency_invariant)
+{
+	// Setup
+	auto size = Size(60, 40);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+	auto settings = MatchSettings(1.0, 10.0, 3, 2, 4);
+	settings.GetSeed() = 7;
+	auto ids = vector<int> { 0, 1, 2, 3, 4 };
+	auto loader = [&size](int id) { return SceneUtils::BuildFrame(id, size); };
+
+	// Execute
+	auto single = vector<Mat>(); auto several = vector<Mat>();
+	auto singleWindow = FrameWindow(ids, loader, BatchMatcher::GetCapacity(1, 1, 1));
+	auto singleMatcher = BatchMatcher(&calibration, &singleWindow, settings, 1, 1, 1); singleMatcher.GetThreads() = 1;
+	singleMatcher.Run([&](Frame *, PatchMatcher * result) { single.push_back(result->GetDepth().clone()); });
+	auto severalWindow = FrameWindow(ids, loader, BatchMatcher::GetCapacity(1, 3, 3));
+	auto severalMatcher = BatchMatcher(&calibration, &severalWindow, settings, 1, 3, 3); severalMatcher.GetThreads() = 6;
+	severalMatcher.Run([&](Frame *, PatchMatcher * result) { several.push_back(result->GetDepth().clone()); });
+
+	// Confirm
+	ASSERT_EQ(single.size(), ids.size()); ASSERT_EQ(several.size(), ids.size());
+	ASSERT_EQ(severalWindow.GetLoads(), (int)ids.size());
+	for (auto i = 0; i < (int)ids.size(); i++)
+	{
+		for (auto row = 0; row < size.height; row++)
+		{
+			for (auto column = 0; column < size.width; column++) ASSERT_EQ(single[i].at<float>(row, column), several[i].at<float>(row, column));
+		}
+	}
+}
+
+/**
+ * @brief Confirm that an error in the sink stops the run and reaches the caller
+ */
+TEST(BatchMatcher_Test, sink_error)
+{
+	// Setup
+	auto size = Size(40, 30);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+	auto settings = MatchSettings(1.0, 10.0, 3, 1, 2);
+	auto ids = vector<int> { 0, 1, 2, 3, 4, 5 };
+	auto loader = [&size](int id) { return SceneUtils::BuildFrame(id, size); };
+	auto window = FrameWindow(ids, loader, BatchMatcher::GetCapacity(1, 2, 2));
+	auto matcher = BatchMatcher(&calibration, &window, settings, 1, 2, 2);
+
+	// Execute
+	auto calls = vector<int>();
+	auto run = [&]() { matcher.Run([&](Frame * reference, PatchMatcher *) { calls.push_back(reference->GetId()); if (reference->GetId() == 1) throw runtime_error("Unable to save"); }); };
+
+	// Confirm
+	ASSERT_THROW(run(), runtime_error);
+	ASSERT_EQ(calls, vector<int>({ 0, 1 }));
+}
@@ -0,0 +1,162 @@
+//--------------------------------------------------
+// Unit Tests for the cost kernel
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/CostKernel.h>
+#include <PatchMatchLib/PMatchUtils.h>
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Build a pair of noise images, with the source shifted 3 pixels to the left
+ * @param size The size of the images
+ * @param reference The resultant reference image
+ * @param source The resultant source image
+ */
+static void BuildImages(const Size& size, Mat& reference, Mat& source)
+{
+	auto rng = RNG(7);
+	Mat noise = Mat(size.height, size.width + 3, CV_32FC1);
+	for (auto row = 0; row < noise.rows; row++)
+	{
+		for (auto column = 0; column < noise.cols; column++) noise.at<float>(row, column) = rng.uniform(0.0f, 255.0f);
+	}
+
+	reference = noise(Rect(0, 0, size.width, size.height)).clone();
+	source = noise(Rect(3, 0, size.width, size.height)).clone();
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the precomputed statistics match a direct sum over the strided window
+ */
+TEST(CostKernel_Test, strided_statistics)
+{
+	// Setup
+	Mat reference, source; BuildImages(Size(23, 17), reference, source);
+	Mat camera = (Mat_<double>(3, 3) << 50, 0, 11, 0, 50, 8, 0, 0, 1);
+	Mat pose = Mat::eye(4, 4, CV_64F);
+	auto pair = ViewPair(camera, reference, source, pose);
+
+	// Execute
+	auto kernel = CostKernel(&pair, 5, 2);
+
+	// Confirm
+	for (auto y = 0; y < reference.rows; y++)
+	{
+		for (auto x = 0; x < reference.cols; x++)
+		{
+			auto sum = 0.0, squares = 0.0; auto count = 0;
+			for (auto row = y - 4; row <= y + 4; row += 2)
+			{
+				for (auto column = x - 4; column <= x + 4; column += 2)
+				{
+					if (row < 0 || column < 0 || row >= reference.rows || column >= reference.cols) continue;
+					auto value = (double)reference.at<float>(row, column); sum += value; squares += value * value; count++;
+				}
+			}
+
+			auto mean = sum / count; auto energy = sqrt(max(0.0, squares - sum * sum / count));
+			auto& statistics = kernel.GetStatistics().at<Vec2f>(y, x);
+			ASSERT_NEAR(statistics[0], mean, 1e-3);
+			ASSERT_NEAR(statistics[1], energy, 1e-2);
+		}
+	}
+}
+
+/**
+ * @brief Confirm that the vectorized path scores hypotheses the same as the portable path
+ * @remarks The paths round differently (the vectorized one uses fused multiply-adds), so a sample that lands
+ * exactly on the border of the source may be kept by one and dropped by the other. A few such pixels are allowed.
+ */
+TEST(CostKernel_Test, vectorized_matches_portable)
+{
+	// Setup
+	auto size = Size(40, 30);
+	Mat reference, source; BuildImages(size, reference, source);
+	Mat camera = (Mat_<double>(3, 3) << 60, 0, 20, 0, 60, 15, 0, 0, 1);
+	Mat pose = Mat::eye(4, 4, CV_64F); pose.at<double>(0, 3) = 0.1;
+	auto pair = ViewPair(camera, reference, source, pose);
+	auto kernel = CostKernel(&pair, 3, 1);
+
+	auto rng = CounterRng(3, 0, 0); const int count = 11;
+	float depths[count]; Vec3f normals[count];
+
+	// Execute
+	auto total = 0, matches = 0;
+	for (auto y = 0; y < size.height; y += 3)
+	{
+		for (auto x = 0; x < size.width; x += 3)
+		{
+			for (auto i = 0; i < count; i++) { depths[i] = rng.Uniform(1.0f, 4.0f); normals[i] = PMatchUtils::GetRandomNormal(rng); }
+			depths[0] = 2.0f; normals[0] = Vec3f(0, 0, -1);
+
+			float vectorized[count], portable[count];
+			kernel.GetVectorized() = true; kernel.GetCosts(x, y, count, depths, normals, vectorized);
+			kernel.GetVectorized() = false; kernel.GetCosts(x, y, count, depths, normals, portable);
+
+			for (auto i = 0; i < count; i++) { total++; if (fabs(vectorized[i] - portable[i]) < 1e-3f) matches++; }
+		}
+	}
+
+	// Confirm
+	ASSERT_GT(matches, total * 0.99);
+}
+
+/**
+ * @brief Confirm that the true plane scores (almost) perfectly
+ * @remarks The source is the reference shifted by 3 pixels, which a fronto-parallel plane at depth 2 produces
+ * with a focal length of 60 and a baseline of 0.1.
+ */
+TEST(CostKernel_Test, true_plane_cost)
+{
+	// Setup
+	Mat reference, source; BuildImages(Size(40, 30), reference, source);
+	Mat camera = (Mat_<double>(3, 3) << 60, 0, 20, 0, 60, 15, 0, 0, 1);
+	Mat pose = Mat::eye(4, 4, CV_64F); pose.at<double>(0, 3) = -0.1;
+	auto pair = ViewPair(camera, reference, source, pose);
+	auto kernel = CostKernel(&pair, 3, 2);
+
+	// Execute
+	auto cost = kernel.GetCost(20, 15, 2.0f, Vec3f(0, 0, -1));
+	auto wrong = kernel.GetCost(20, 15, 3.0f, Vec3f(0, 0, -1));
+
+	// Confirm
+	ASSERT_LT(cost, 1e-3f);
+	ASSERT_GT(wrong, 0.5f);
+}
+
+/**
+ * @brief Confirm that a kernel built on shared statistics scores the same as one that builds its own
+ * @remarks The statistics of a reference are built once and handed to the kernels of every source, so the shared
+ * constructor must check that they belong to the reference (the same size, as mean and energy pairs).
+ */
+TEST(CostKernel_Test, shared_statistics)
+{
+	// Setup
+	Mat reference, source; BuildImages(Size(40, 30), reference, source);
+	Mat camera = (Mat_<double>(3, 3) << 60, 0, 20, 0, 60, 15, 0, 0, 1);
+	Mat pose = Mat::eye(4, 4, CV_64F); pose.at<double>(0, 3) = -0.1;
+	auto pair = ViewPair(camera, reference, source, pose);
+	Mat statistics = CostKernel::BuildStatistics(reference, 3, 2); Mat wrong = Mat(10, 10, CV_32FC2, Scalar(0, 0));
+
+	// Execute
+	auto owner = CostKernel(&pair, 3, 2); auto shared = CostKernel(&pair, 3, 2, statistics);
+
+	// Confirm
+	ASSERT_EQ(shared.GetStatistics().data, statistics.data);
+	for (auto depth : { 1.5f, 2.0f, 3.0f }) ASSERT_EQ(shared.GetCost(20, 15, depth, Vec3f(0, 0, -1)), owner.GetCost(20, 15, depth, Vec3f(0, 0, -1)));
+	ASSERT_THROW(CostKernel(&pair, 3, 2, wrong), runtime_error);
+}
@@ -0,0 +1,83 @@
+//--------------------------------------------------
+// Unit Tests for the counter-based random number generator
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/CounterRng.h>
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the numbers only depend on the seed, the stream and the position
+ */
+TEST(CounterRng_Test, keyed_sequence)
+{
+	// Setup
+	auto first = CounterRng(7, 3, 1000); auto second = CounterRng(7, 3, 1000);
+	auto otherSeed = CounterRng(8, 3, 1000); auto otherStream = CounterRng(7, 4, 1000); auto otherPosition = CounterRng(7, 3, 1001);
+
+	// Execute
+	auto same = 0, seedMatches = 0, streamMatches = 0, positionMatches = 0;
+	for (auto i = 0; i < 64; i++)
+	{
+		auto value = first.Next();
+		if (value == second.Next()) same++;
+		if (value == otherSeed.Next()) seedMatches++;
+		if (value == otherStream.Next()) streamMatches++;
+		if (value == otherPosition.Next()) positionMatches++;
+	}
+
+	// Confirm
+	ASSERT_EQ(same, 64);
+	ASSERT_LE(seedMatches, 1);
+	ASSERT_LE(streamMatches, 1);
+	ASSERT_LE(positionMatches, 1);
+}
+
+/**
+ * @brief Confirm that neighbouring positions give uniform, uncorrelated first draws
+ * @remarks Every pixel draws its first number from a fresh generator, so this is the case that matters most.
+ */
+TEST(CounterRng_Test, uniform_across_positions)
+{
+	// Setup
+	const int count = 100000; int bins[10] = {}; auto sum = 0.0, product = 0.0; auto previous = 0.0f;
+
+	// Execute
+	for (auto position = 0; position < count; position++)
+	{
+		auto rng = CounterRng(1, 0, position); auto value = rng.Uniform(0.0f, 1.0f);
+		ASSERT_GE(value, 0.0f); ASSERT_LT(value, 1.0f);
+
+		bins[(int)(value * 10)]++; sum += value; product += (value - 0.5) * (previous - 0.5); previous = value;
+	}
+
+	// Confirm
+	for (auto bin : bins) ASSERT_NEAR(bin, count / 10, count / 100);
+	ASSERT_NEAR(sum / count, 0.5, 0.01);
+	ASSERT_NEAR(product / count, 0.0, 0.002);
+}
+
+/**
+ * @brief Confirm that integer draws stay within their range
+ */
+TEST(CounterRng_Test, integer_range)
+{
+	// Setup
+	auto rng = CounterRng(5, 1, 2); auto low = 10, high = 0;
+
+	// Execute
+	for (auto i = 0; i < 1000; i++) { auto value = rng.Uniform(3, 7); low = min(low, value); high = max(high, value); }
+
+	// Confirm
+	ASSERT_EQ(low, 3);
+	ASSERT_EQ(high, 6);
+}
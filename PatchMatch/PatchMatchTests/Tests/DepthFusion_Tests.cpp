@@ -0,0 +1,97 @@
+//--------------------------------------------------
+// Unit Tests for the depth map fusion
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/DepthFusion.h>
+using namespace NVL_App;
+
+#include "SceneUtils.h"
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Build a camera (with a focal length of 100) that looks down the z axis at a plane at a depth of 4, moved sideways along a line
+ * @param position The index of the camera along the line (the cameras are 0.2 apart, so 5 pixels of disparity)
+ * @param image The resultant image of the plane
+ * @param pose The resultant pose
+ * @param depth The resultant depth map
+ */
+static void BuildView(int position, Mat& image, Mat& pose, Mat& depth)
+{
+	auto size = Size(40, 30);
+	image = SceneUtils::Render(size, 5.0 * position); pose = SceneUtils::GetPose(0.2 * position);
+	depth = Mat(size, CV_32FC1, Scalar::all(4.0f));
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a streamed sequence keeps the points that its neighbours agree with, and holds a bounded window
+ * @remarks The middle view has a block of wrong depths, which its neighbours see as too far, so none of it is kept.
+ */
+TEST(DepthFusion_Test, fuse_consistent)
+{
+	// Setup
+	auto calibration = SceneUtils::GetCalibration(Size(40, 30), 100);
+	auto voxels = VoxelHash(0.05);
+	auto fusion = DepthFusion(&calibration, &voxels, 1, 0.01, 10.0, 1);
+
+	// Execute
+	auto held = 0;
+	for (auto position = 0; position < 5; position++)
+	{
+		Mat image, pose, depth; BuildView(position, image, pose, depth);
+		if (position == 2) depth(Rect(10, 10, 10, 10)).setTo(Scalar::all(6.0f));
+
+		auto frame = Frame(position, image, pose);
+		fusion.Add(&frame, depth);
+		held = max(held, fusion.GetHeld());
+	}
+	fusion.Finish();
+
+	// Confirm
+	ASSERT_LE(held, 3);
+	ASSERT_EQ(fusion.GetHeld(), 0);
+	ASSERT_EQ(fusion.GetFused(), 5);
+	ASSERT_GE(fusion.GetRejected(), (size_t)100);
+	ASSERT_GT(fusion.GetAccepted(), (size_t)(5 * 40 * 30) / 2);
+
+	vector<Vec3f> points; vector<Vec3b> colours; voxels.GetPoints(points, colours);
+	ASSERT_GT(points.size(), (size_t)0);
+	for (auto& point : points) ASSERT_NEAR(point[2], 4.0f, 0.01f);
+}
+
+/**
+ * @brief Confirm that pixels whose depths agree but whose intensities do not are dropped
+ */
+TEST(DepthFusion_Test, photometric_check)
+{
+	// Setup
+	auto calibration = SceneUtils::GetCalibration(Size(40, 30), 100);
+
+	Mat image1, pose1, depth1; BuildView(0, image1, pose1, depth1); image1.setTo(Scalar::all(0));
+	Mat image2, pose2, depth2; BuildView(1, image2, pose2, depth2); image2.setTo(Scalar::all(255));
+	auto frame1 = Frame(0, image1, pose1); auto frame2 = Frame(1, image2, pose2);
+
+	auto strictVoxels = VoxelHash(0.05); auto looseVoxels = VoxelHash(0.05);
+	auto strict = DepthFusion(&calibration, &strictVoxels, 1, 0.01, 10.0, 1);
+	auto loose = DepthFusion(&calibration, &looseVoxels, 1, 0.01, 0.0, 1);
+
+	// Execute
+	strict.Add(&frame1, depth1); strict.Add(&frame2, depth2); strict.Finish();
+	loose.Add(&frame1, depth1); loose.Add(&frame2, depth2); loose.Finish();
+
+	// Confirm
+	ASSERT_EQ(strict.GetAccepted(), (size_t)0);
+	ASSERT_GT(loose.GetAccepted(), (size_t)(2 * 40 * 30) / 2);
+}
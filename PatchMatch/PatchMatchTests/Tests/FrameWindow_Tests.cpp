@@ -0,0 +1,76 @@
+//--------------------------------------------------
+// Unit Tests for the frame window
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <map>
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/FrameWindow.h>
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Build a loader that makes small blank frames and counts how often each is loaded
+ * @param loads The number of loads of each identifier
+ * @return FrameWindow::Loader The resultant loader
+ */
+static FrameWindow::Loader GetLoader(map<int, int>& loads)
+{
+	return [&loads](int id)
+	{
+		Mat image = Mat(4, 4, CV_8UC1, Scalar::all(id)); Mat pose = Mat::eye(4, 4, CV_64F);
+		loads[id]++; return new Frame(id, image, pose);
+	};
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a sliding window loads each frame once and holds the frames it was asked for
+ */
+TEST(FrameWindow_Test, load_once)
+{
+	// Setup
+	auto loads = map<int, int>(); auto ids = vector<int> { 3, 5, 8, 13, 21, 34, 55 };
+	auto window = FrameWindow(ids, GetLoader(loads), 4);
+
+	// Execute
+	for (auto first = -1; first < 5; first++)
+	{
+		window.Advance(first, first + 4);
+
+		// Confirm
+		for (auto position = max(first, 0); position < min(first + 4, (int)ids.size()); position++) ASSERT_EQ(window.Get(position)->GetId(), ids[position]);
+		if (first > 0) { ASSERT_THROW(window.Get(first - 1), runtime_error); }
+	}
+
+	ASSERT_EQ(window.GetLoads(), (int)ids.size());
+	for (auto id : ids) ASSERT_EQ(loads[id], 1);
+}
+
+/**
+ * @brief Confirm that the window rejects requests that would reload frames or overflow it
+ */
+TEST(FrameWindow_Test, reject_invalid_moves)
+{
+	// Setup
+	auto loads = map<int, int>(); auto ids = vector<int> { 0, 1, 2, 3, 4, 5 };
+	auto window = FrameWindow(ids, GetLoader(loads), 3);
+	window.Advance(2, 5);
+
+	// Confirm
+	ASSERT_THROW(window.Advance(1, 5), runtime_error);
+	ASSERT_THROW(window.Advance(2, 6), runtime_error);
+	ASSERT_THROW(window.Get(5), runtime_error);
+	ASSERT_EQ(window.GetLoads(), 3);
+}
@@ -0,0 +1,102 @@
+//--------------------------------------------------
+// Unit Tests for the half precision storage helpers
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/HalfUtils.h>
+#include <PatchMatchLib/PMatchUtils.h>
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that storing depths and normals in half precision halves their memory and rounds them by at most
+ * half a unit in the last place (a relative error of 2^-11)
+ */
+TEST(HalfUtils_Test, round_trip_precision)
+{
+	// Setup
+	auto size = Size(64, 48);
+	Mat depth = PMatchUtils::CreateMap(size, 0.5, 10.0, 1, 0); Mat normals = PMatchUtils::CreateNormals(size, 1, 1);
+	Mat halfDepth = depth.clone(); Mat halfNormals = normals.clone();
+
+	// Execute
+	HalfUtils::Store(halfDepth, true); HalfUtils::Store(halfNormals, true);
+
+	// Confirm
+	ASSERT_EQ(halfDepth.type(), CV_16FC1); ASSERT_EQ(halfNormals.type(), CV_16FC3);
+	ASSERT_EQ(halfDepth.total() * halfDepth.elemSize() * 2, depth.total() * depth.elemSize());
+	ASSERT_EQ(halfNormals.total() * halfNormals.elemSize() * 2, normals.total() * normals.elemSize());
+
+	auto depthError = 0.0, normalError = 0.0;
+	for (auto row = 0; row < size.height; row++)
+	{
+		for (auto column = 0; column < size.width; column++)
+		{
+			auto value = depth.at<float>(row, column);
+			depthError = max(depthError, (double)fabs(HalfUtils::Get<float16_t>(halfDepth, column, row) - value) / value);
+
+			auto normal = normals.at<Vec3f>(row, column); auto stored = HalfUtils::GetVector<float16_t>(halfNormals, column, row);
+			for (auto axis = 0; axis < 3; axis++) normalError = max(normalError, (double)fabs(stored[axis] - normal[axis]));
+		}
+	}
+
+	RecordProperty("depth_relative_error", to_string(depthError)); RecordProperty("normal_error", to_string(normalError));
+	ASSERT_LE(depthError, 1.0 / 2048);
+	ASSERT_LE(normalError, 1.0 / 2048);
+}
+
+/**
+ * @brief Confirm that values are written and read through either precision, and widened on request
+ */
+TEST(HalfUtils_Test, set_and_widen)
+{
+	// Setup
+	Mat single = Mat(2, 3, CV_32FC1, Scalar::all(0)); Mat half = Mat(2, 3, CV_16FC1, Scalar::all(0));
+	Mat normals = Mat(2, 3, CV_16FC3, Scalar::all(0));
+
+	// Execute
+	HalfUtils::Set<float>(single, 2, 1, 3.1f); HalfUtils::Set<float16_t>(half, 2, 1, 3.1f);
+	HalfUtils::SetVector<float16_t>(normals, 1, 0, Vec3f(0.6f, 0, -0.8f));
+	Mat widened = HalfUtils::ToFloat(half);
+
+	// Confirm
+	ASSERT_EQ(HalfUtils::Get<float>(single, 2, 1), 3.1f);
+	ASSERT_NEAR(HalfUtils::Get<float16_t>(half, 2, 1), 3.1f, 3.1f / 2048);
+	ASSERT_EQ(widened.type(), CV_32FC1);
+	ASSERT_EQ(widened.at<float>(1, 2), HalfUtils::Get<float16_t>(half, 2, 1));
+	ASSERT_NEAR(HalfUtils::GetVector<float16_t>(normals, 1, 0)[2], -0.8f, 1e-3f);
+	ASSERT_EQ(HalfUtils::ToFloat(single).data, single.data);
+}
+
+/**
+ * @brief Confirm that rows are widened and stored in one conversion, and that single precision rows are used in place
+ */
+TEST(HalfUtils_Test, row_conversion)
+{
+	// Setup
+	Mat normals = PMatchUtils::CreateNormals(Size(16, 4), 1, 1); Mat half = normals.clone(); HalfUtils::Store(half, true);
+	auto buffer = vector<Vec3f>(16); auto rowBuffer = vector<Vec3f>(16);
+
+	// Execute
+	auto widened = (const Vec3f *)HalfUtils::ReadRow<float16_t>(half, 2, (float *)buffer.data());
+	auto direct = HalfUtils::ReadRow<float>(normals, 2, (float *)buffer.data());
+	auto target = (Vec3f *)HalfUtils::GetRowBuffer<float16_t>(half, 3, (float *)rowBuffer.data());
+	for (auto column = 0; column < 16; column++) target[column] = Vec3f(0, 0, -1);
+	HalfUtils::WriteRow<float16_t>(half, 3, (const float *)target);
+
+	// Confirm
+	ASSERT_EQ(direct, normals.ptr<float>(2));
+	for (auto column = 0; column < 16; column++)
+	{
+		ASSERT_EQ(widened[column], HalfUtils::GetVector<float16_t>(half, column, 2));
+		ASSERT_EQ(HalfUtils::GetVector<float16_t>(half, column, 3), Vec3f(0, 0, -1));
+	}
+}
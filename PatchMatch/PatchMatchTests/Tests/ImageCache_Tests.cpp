@@ -0,0 +1,126 @@
+//--------------------------------------------------
+// Unit Tests for the image cache
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/Frame.h>
+#include <PatchMatchLib/ImageCache.h>
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a derived image is built once and then shared
+ */
+TEST(ImageCache_Test, build_once)
+{
+	// Setup
+	auto cache = ImageCache(1 << 20);
+	Mat image = Mat(10, 12, CV_8UC3, Scalar(10, 20, 30)); Mat pose = Mat::eye(4, 4, CV_64F);
+	auto frame = Frame(3, image, pose); frame.GetCache() = &cache;
+
+	// Execute
+	Mat first = frame.GetGray(); Mat second = frame.GetGray();
+
+	// Confirm
+	ASSERT_EQ(first.data, second.data);
+	ASSERT_EQ(first.type(), CV_32FC1);
+	ASSERT_EQ(cache.GetMisses(), 1);
+	ASSERT_EQ(cache.GetHits(), 1);
+}
+
+/**
+ * @brief Confirm that the least recently used image is evicted when the cache is full
+ */
+TEST(ImageCache_Test, evict_least_recent)
+{
+	// Setup
+	auto cache = ImageCache(2 * 100 * sizeof(float));
+	auto factory = []() { return Mat(10, 10, CV_32FC1, Scalar(1)); };
+
+	// Execute
+	cache.Get(ImageCache::Key(1, CACHE_GRAY, 0, 0, 0), factory);
+	cache.Get(ImageCache::Key(2, CACHE_GRAY, 0, 0, 0), factory);
+	cache.Get(ImageCache::Key(1, CACHE_GRAY, 0, 0, 0), factory);
+	cache.Get(ImageCache::Key(3, CACHE_GRAY, 0, 0, 0), factory);
+	cache.Get(ImageCache::Key(1, CACHE_GRAY, 0, 0, 0), factory);
+	cache.Get(ImageCache::Key(2, CACHE_GRAY, 0, 0, 0), factory);
+
+	// Confirm
+	ASSERT_EQ(cache.GetCount(), 2);
+	ASSERT_LE(cache.GetBytes(), cache.GetLimit());
+	ASSERT_EQ(cache.GetMisses(), 4);
+	ASSERT_EQ(cache.GetEvictions(), 2);
+}
+
+/**
+ * @brief Confirm that threads asking for the same image at the same time only build it once
+ */
+TEST(ImageCache_Test, concurrent_build_once)
+{
+	// Setup
+	auto cache = ImageCache(1 << 20); auto builds = atomic<int>(0);
+	auto factory = [&builds]() { builds++; this_thread::sleep_for(chrono::milliseconds(20)); return Mat(4, 4, CV_32FC1, Scalar(2)); };
+
+	// Execute
+	vector<thread> threads; vector<uchar *> data(8);
+	for (auto i = 0; i < 8; i++) threads.push_back(thread([&, i]() { data[i] = cache.Get(ImageCache::Key(0, CACHE_LEVEL, 1, 0, 0), factory).data; }));
+	for (auto& worker : threads) worker.join();
+
+	// Confirm
+	ASSERT_EQ(builds.load(), 1);
+	for (auto i = 1; i < 8; i++) ASSERT_EQ(data[i], data[0]);
+}
+
+/**
+ * @brief Confirm that the pyramid levels halve in size and are built from the cached level above
+ */
+TEST(ImageCache_Test, pyramid_levels)
+{
+	// Setup
+	auto cache = ImageCache(1 << 20);
+	Mat image = Mat(32, 48, CV_8UC1, Scalar(100)); Mat pose = Mat::eye(4, 4, CV_64F);
+	auto frame = Frame(0, image, pose); frame.GetCache() = &cache;
+
+	// Execute
+	Mat level = frame.GetLevel(2);
+
+	// Confirm
+	ASSERT_EQ(level.cols, 12);
+	ASSERT_EQ(level.rows, 8);
+	ASSERT_EQ(cache.GetMisses(), 3);
+	ASSERT_NEAR(level.at<float>(4, 6), 100.0f, 1e-3f);
+}
+
+/**
+ * @brief Confirm that the window statistics are cached per level, window and stride
+ */
+TEST(ImageCache_Test, window_statistics)
+{
+	// Setup
+	auto cache = ImageCache(1 << 20);
+	Mat image = Mat(32, 48, CV_8UC1, Scalar(100)); Mat pose = Mat::eye(4, 4, CV_64F);
+	auto frame = Frame(0, image, pose); frame.GetCache() = &cache;
+
+	// Execute
+	Mat first = frame.GetStatistics(1, 3, 2); Mat second = frame.GetStatistics(1, 3, 2);
+	Mat strided = frame.GetStatistics(1, 3, 1);
+
+	// Confirm
+	ASSERT_EQ(first.data, second.data);
+	ASSERT_NE(first.data, strided.data);
+	ASSERT_EQ(first.type(), CV_32FC2);
+	ASSERT_EQ(first.size(), Size(24, 16));
+	ASSERT_NEAR(first.at<Vec2f>(5, 7)[0], 100.0f, 1e-3f);
+	ASSERT_NEAR(first.at<Vec2f>(5, 7)[1], 0.0f, 1e-3f);
+}
@@ -0,0 +1,286 @@
+//--------------------------------------------------
+// Unit Tests for the PatchMatch engine
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/PatchMatcher.h>
+using namespace NVL_App;
+
+#include "SceneUtils.h"
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Count the values of two CV_32F maps that are not bitwise equal
+ * @param first The first map
+ * @param second The second map
+ * @return int The number of differences
+ */
+static int CountDifferences(Mat& first, Mat& second)
+{
+	auto result = 0;
+	for (auto row = 0; row < first.rows; row++)
+	{
+		for (auto column = 0; column < first.cols; column++) if (first.at<float>(row, column) != second.at<float>(row, column)) result++;
+	}
+	return result;
+}
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the initial map lies within the requested range
+ */
+TEST(PatchMatcher_Test, create_map_range)
+{
+	// Execute
+	Mat map = PMatchUtils::CreateMap(Size(20, 10), 2.0, 3.0, 1, 0);
+	double minValue, maxValue; minMaxIdx(map, &minValue, &maxValue);
+
+	// Confirm
+	ASSERT_GE(minValue, 2.0);
+	ASSERT_LE(maxValue, 3.0);
+}
+
+/**
+ * @brief Confirm that a fronto-parallel plane is recovered from two views
+ * @remarks The plane is 4 units away and the source camera is 0.2 units to the side, so with a focal length
+ * of 100 the disparity is 5 pixels.
+ */
+TEST(PatchMatcher_Test, recover_plane)
+{
+	// Setup
+	auto size = Size(80, 60);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+
+	Mat referenceImage = SceneUtils::Render(size, 0); Mat referencePose = SceneUtils::GetPose(0);
+	Mat sourceImage = SceneUtils::Render(size, 5); Mat sourcePose = SceneUtils::GetPose(0.2);
+	auto reference = Frame(0, referenceImage, referencePose);
+	auto source = Frame(1, sourceImage, sourcePose);
+
+	auto settings = MatchSettings(1.0, 10.0, 3, 4, 4);
+	auto sources = vector<Frame *> { &source };
+
+	// Execute
+	auto matcher = PatchMatcher(&calibration, &reference, sources, settings);
+	matcher.Run();
+
+	// Confirm
+	auto good = 0, total = 0;
+	for (auto row = 5; row < size.height - 5; row++)
+	{
+		for (auto column = 5; column < size.width - 10; column++)
+		{
+			total++; if (fabs(matcher.GetDepth().at<float>(row, column) - 4.0f) < 0.2f) good++;
+		}
+	}
+	ASSERT_GT(good, total * 0.9);
+}
+
+/**
+ * @brief Confirm that the views are chosen per pixel, so that a view that does not match is left out
+ * @remarks Two sources see the plane (one to each side) and a third shows unrelated texture. With two views per
+ * pixel, the top-k selection should settle on the two good sources almost everywhere.
+ */
+TEST(PatchMatcher_Test, select_views)
+{
+	// Setup
+	auto size = Size(80, 60);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+
+	Mat referenceImage = SceneUtils::Render(size, 0); Mat referencePose = SceneUtils::GetPose(0);
+	Mat leftImage = SceneUtils::Render(size, 5); Mat leftPose = SceneUtils::GetPose(0.2);
+	Mat rightImage = SceneUtils::Render(size, -5); Mat rightPose = SceneUtils::GetPose(-0.2);
+	Mat wrongImage = Mat(size, CV_8UC1); Mat wrongPose = SceneUtils::GetPose(0.1);
+	auto rng = RNG(11); for (auto i = 0; i < (int)wrongImage.total(); i++) wrongImage.data[i] = (uchar)rng.uniform(0, 256);
+
+	auto reference = Frame(0, referenceImage, referencePose);
+	auto wrong = Frame(1, wrongImage, wrongPose);
+	auto left = Frame(2, leftImage, leftPose);
+	auto right = Frame(3, rightImage, rightPose);
+	auto sources = vector<Frame *> { &wrong, &left, &right };
+
+	for (auto selection : { SELECT_TOP_K, SELECT_SAMPLE })
+	{
+		auto settings = MatchSettings(1.0, 10.0, 3, 4, 4);
+		settings.GetViewCount() = 2; settings.GetSelection() = selection;
+
+		// Execute
+		auto matcher = PatchMatcher(&calibration, &reference, sources, settings);
+		matcher.Run();
+
+		// Confirm
+		auto total = 0; auto good = SceneUtils::CountGood(matcher.GetDepth(), 4.0f, total);
+		ASSERT_GT(good, total * 0.9);
+
+		auto wrongCount = 0;
+		for (auto row = 5; row < size.height - 5; row++)
+		{
+			for (auto column = 10; column < size.width - 10; column++) if (matcher.GetViews().at<int>(row, column) & 1) wrongCount++;
+		}
+		ASSERT_LT(wrongCount, total * 0.1);
+	}
+}
+
+/**
+ * @brief Confirm that the plane is recovered coarse-to-fine, with two iterations at each finer level
+ * @remarks The image is 128 x 96, so three levels keep the coarsest level above the 16 pixel minimum.
+ */
+TEST(PatchMatcher_Test, recover_plane_pyramid)
+{
+	// Setup
+	auto size = Size(128, 96);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+
+	Mat referenceImage = SceneUtils::Render(size, 0); Mat referencePose = SceneUtils::GetPose(0);
+	Mat sourceImage = SceneUtils::Render(size, 5); Mat sourcePose = SceneUtils::GetPose(0.2);
+	auto reference = Frame(0, referenceImage, referencePose);
+	auto source = Frame(1, sourceImage, sourcePose);
+	auto sources = vector<Frame *> { &source };
+
+	auto settings = MatchSettings(1.0, 10.0, 3, 3, 4);
+	settings.GetLevels() = 3; settings.GetLevelIterations() = 2;
+
+	// Execute
+	auto matcher = PatchMatcher(&calibration, &reference, sources, settings);
+	matcher.Run();
+
+	// Confirm
+	ASSERT_EQ(matcher.GetLevel(), 0);
+	ASSERT_EQ(matcher.GetDepth().size(), size);
+	auto total = 0; auto good = SceneUtils::CountGood(matcher.GetDepth(), 4.0f, total);
+	ASSERT_GT(good, total * 0.9);
+}
+
+/**
+ * @brief Confirm that the active set shrinks as the pixels converge, and that the run stops early
+ */
+TEST(PatchMatcher_Test, stop_when_converged)
+{
+	// Setup
+	auto size = Size(80, 60);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+
+	Mat referenceImage = SceneUtils::Render(size, 0); Mat referencePose = SceneUtils::GetPose(0);
+	Mat sourceImage = SceneUtils::Render(size, 5); Mat sourcePose = SceneUtils::GetPose(0.2);
+	auto reference = Frame(0, referenceImage, referencePose);
+	auto source = Frame(1, sourceImage, sourcePose);
+	auto sources = vector<Frame *> { &source };
+
+	auto settings = MatchSettings(1.0, 10.0, 3, 20, 4);
+	settings.GetMinActive() = 0.02;
+
+	// Execute
+	auto matcher = PatchMatcher(&calibration, &reference, sources, settings);
+	matcher.Run();
+
+	// Confirm
+	ASSERT_LT(matcher.GetPasses(), 20);
+	ASSERT_LT(matcher.GetUpdates(), (size_t)matcher.GetPasses() * size.area());
+	auto total = 0; auto good = SceneUtils::CountGood(matcher.GetDepth(), 4.0f, total);
+	ASSERT_GT(good, total * 0.9);
+}
+
+/**
+ * @brief Confirm that a run gives the same result for the same seed, whatever the number of threads
+ */
+TEST(PatchMatcher_Test, reproducible_across_threads)
+{
+	// Setup
+	auto size = Size(80, 60);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+
+	Mat referenceImage = SceneUtils::Render(size, 0); Mat referencePose = SceneUtils::GetPose(0);
+	Mat sourceImage = SceneUtils::Render(size, 5); Mat sourcePose = SceneUtils::GetPose(0.2);
+	auto reference = Frame(0, referenceImage, referencePose);
+	auto source = Frame(1, sourceImage, sourcePose);
+	auto sources = vector<Frame *> { &source };
+
+	auto settings = MatchSettings(1.0, 10.0, 3, 2, 4);
+	settings.GetSelection() = SELECT_SAMPLE; settings.GetLevels() = 2; settings.GetSeed() = 42;
+	auto threads = getNumThreads();
+
+	// Execute
+	setNumThreads(1);
+	auto single = PatchMatcher(&calibration, &reference, sources, settings); single.Run();
+	setNumThreads(4);
+	auto multiple = PatchMatcher(&calibration, &reference, sources, settings); multiple.Run();
+	setNumThreads(threads);
+
+	settings.GetSeed() = 43;
+	auto other = PatchMatcher(&calibration, &reference, sources, settings); other.Run();
+
+	// Confirm
+	ASSERT_EQ(CountDifferences(single.GetDepth(), multiple.GetDepth()), 0);
+	ASSERT_EQ(CountDifferences(single.GetCosts(), multiple.GetCosts()), 0);
+	ASSERT_GT(CountDifferences(single.GetDepth(), other.GetDepth()), 0);
+}
+
+/**
+ * @brief Measure what storing the run in half precision costs, against the same run in single precision
+ * @remarks The depth, mean cost and normal differences, and the peak bytes that the maps of each run held, are
+ * reported as test properties, so that the loss and the saving can be followed from run to run. Half precision
+ * rounds a depth near 4 to a step of 2^-8, so the two runs drift apart a little as they go, but both must still
+ * recover the plane.
+ */
+TEST(PatchMatcher_Test, half_precision)
+{
+	// Setup
+	auto size = Size(80, 60);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+
+	Mat referenceImage = SceneUtils::Render(size, 0); Mat referencePose = SceneUtils::GetPose(0);
+	Mat sourceImage = SceneUtils::Render(size, 5); Mat sourcePose = SceneUtils::GetPose(0.2);
+	auto reference = Frame(0, referenceImage, referencePose);
+	auto source = Frame(1, sourceImage, sourcePose);
+	auto sources = vector<Frame *> { &source };
+
+	auto settings = MatchSettings(1.0, 10.0, 3, 4, 4);
+	settings.GetLevels() = 2; settings.GetLevelIterations() = 2;
+
+	// Execute
+	auto single = PatchMatcher(&calibration, &reference, sources, settings); single.Run();
+	settings.GetHalfPrecision() = true;
+	auto half = PatchMatcher(&calibration, &reference, sources, settings); half.Run();
+
+	// Confirm
+	ASSERT_EQ(half.GetDepth().type(), CV_32FC1);
+	ASSERT_EQ(half.GetNormals().type(), CV_32FC3);
+	ASSERT_EQ(half.GetCosts().type(), CV_32FC1);
+
+	auto singleTotal = 0, halfTotal = 0;
+	auto singleGood = SceneUtils::CountGood(single.GetDepth(), 4.0f, singleTotal); auto halfGood = SceneUtils::CountGood(half.GetDepth(), 4.0f, halfTotal);
+
+	auto depthError = 0.0, singleCost = 0.0, halfCost = 0.0, normalError = 0.0; auto count = 0;
+	for (auto row = 5; row < size.height - 5; row++)
+	{
+		for (auto column = 10; column < size.width - 10; column++)
+		{
+			depthError += fabs(half.GetDepth().at<float>(row, column) - 4.0f) - fabs(single.GetDepth().at<float>(row, column) - 4.0f);
+			singleCost += single.GetCosts().at<float>(row, column); halfCost += half.GetCosts().at<float>(row, column);
+			normalError += norm(half.GetNormals().at<Vec3f>(row, column) - single.GetNormals().at<Vec3f>(row, column));
+			count++;
+		}
+	}
+	depthError /= count; singleCost /= count; halfCost /= count; normalError /= count;
+
+	RecordProperty("good_single", singleGood); RecordProperty("good_half", halfGood);
+	RecordProperty("extra_depth_error", to_string(depthError)); RecordProperty("extra_cost", to_string(halfCost - singleCost));
+	RecordProperty("normal_difference", to_string(normalError));
+	RecordProperty("peak_bytes_single", (int)single.GetPeakBytes()); RecordProperty("peak_bytes_half", (int)half.GetPeakBytes());
+
+	ASSERT_GT(halfGood, halfTotal * 0.9);
+	ASSERT_GT(halfGood, singleGood - singleTotal / 50);
+	ASSERT_LT(depthError, 0.02);
+	ASSERT_LT(halfCost - singleCost, 0.02);
+	ASSERT_LT(half.GetPeakBytes() * 10, single.GetPeakBytes() * 7);
+}
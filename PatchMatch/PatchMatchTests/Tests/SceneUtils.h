@@ -0,0 +1,110 @@
+//--------------------------------------------------
+// Utility: Synthetic scenes for the tests (a textured fronto-parallel plane seen by cameras moving sideways)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <PatchMatchLib/Calibration.h>
+#include <PatchMatchLib/Frame.h>
+using namespace NVL_App;
+
+class SceneUtils
+{
+public:
+	/**
+	 * @brief A non-repeating texture (bilinear value noise on a 2 pixel lattice)
+	 * @param x The x coordinate that we are sampling
+	 * @param y The y coordinate that we are sampling
+	 * @return double The intensity at the point
+	 */
+	static inline double GetTexture(double x, double y)
+	{
+		auto lattice = [](int u, int v) { auto hash = (uint32_t)(u * 73856093) ^ (uint32_t)(v * 19349663); hash = (hash ^ (hash >> 13)) * 0x5bd1e995u; return (double)((hash ^ (hash >> 15)) & 0xFF); };
+
+		auto u = x / 2.0, v = y / 2.0; auto u0 = (int)floor(u), v0 = (int)floor(v); auto au = u - u0, av = v - v0;
+		return (1 - av) * ((1 - au) * lattice(u0, v0) + au * lattice(u0 + 1, v0)) + av * ((1 - au) * lattice(u0, v0 + 1) + au * lattice(u0 + 1, v0 + 1));
+	}
+
+	/**
+	 * @brief Render the texture on a fronto-parallel plane as seen by a camera shifted sideways
+	 * @param size The size of the image
+	 * @param shift The horizontal disparity (in pixels) of the plane
+	 * @return Mat The resultant CV_8U image
+	 */
+	static inline Mat Render(const Size& size, double shift)
+	{
+		Mat result = Mat(size, CV_8UC1);
+		for (auto row = 0; row < size.height; row++)
+		{
+			for (auto column = 0; column < size.width; column++) result.at<uchar>(row, column) = (uchar)round(GetTexture(column - shift, row));
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Build a 4x4 pose that translates along x
+	 * @param x The translation
+	 * @return Mat The resultant pose
+	 */
+	static inline Mat GetPose(double x)
+	{
+		Mat result = Mat::eye(4, 4, CV_64F); result.at<double>(0, 3) = x;
+		return result;
+	}
+
+	/**
+	 * @brief Build the calibration of an undistorted camera whose principal point is the centre of the image
+	 * @param size The size of the image
+	 * @param focal The focal length (in pixels)
+	 * @return Calibration The resultant calibration
+	 */
+	static inline Calibration GetCalibration(const Size& size, double focal)
+	{
+		Mat camera = (Mat_<double>(3, 3) << focal, 0, size.width / 2, 0, focal, size.height / 2, 0, 0, 1);
+		Mat distortion = Mat::zeros(4, 1, CV_64F);
+		return Calibration(camera, distortion, size);
+	}
+
+	/**
+	 * @brief Build a frame of a sequence that tracks sideways past the plane (at a depth of 4, with a focal length of 100)
+	 * @param id The identifier (and position) of the frame
+	 * @param size The size of the image
+	 * @return Frame * A frame whose camera is 0.2 units further along than the one before (5 pixels of disparity)
+	 */
+	static inline Frame * BuildFrame(int id, const Size& size)
+	{
+		Mat image = Render(size, 5.0 * id); Mat pose = GetPose(0.2 * id);
+		return new Frame(id, image, pose);
+	}
+
+	/**
+	 * @brief Count the interior pixels whose depth is close to the expected depth
+	 * @param depth The depth map
+	 * @param expected The expected depth
+	 * @param total The number of interior pixels
+	 * @return int The number of pixels within 0.2 of the expected depth
+	 */
+	static inline int CountGood(Mat& depth, float expected, int& total)
+	{
+		auto result = 0; total = 0;
+		for (auto row = 5; row < depth.rows - 5; row++)
+		{
+			for (auto column = 10; column < depth.cols - 10; column++)
+			{
+				total++; if (fabs(depth.at<float>(row, column) - expected) < 0.2f) result++;
+			}
+		}
+		return result;
+	}
+};
@@ -0,0 +1,104 @@
+//--------------------------------------------------
+// Unit Tests for the tiled PatchMatch engine
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/TiledMatcher.h>
+using namespace NVL_App;
+
+#include "SceneUtils.h"
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the tiles cover the image exactly once
+ */
+TEST(TiledMatcher_Test, tiles_cover_image)
+{
+	// Setup
+	auto size = Size(100, 70);
+
+	// Execute
+	auto tiles = TiledMatcher::GetTiles(size, 32);
+
+	// Confirm
+	Mat coverage = Mat(size, CV_32SC1, Scalar::all(0));
+	for (auto& tile : tiles)
+	{
+		for (auto row = tile.y; row < tile.y + tile.height; row++)
+		{
+			for (auto column = tile.x; column < tile.x + tile.width; column++) coverage.at<int>(row, column)++;
+		}
+	}
+
+	ASSERT_EQ((int)tiles.size(), 12);
+	for (auto row = 0; row < size.height; row++)
+	{
+		for (auto column = 0; column < size.width; column++) ASSERT_EQ(coverage.at<int>(row, column), 1);
+	}
+}
+
+/**
+ * @brief Confirm that a plane is recovered tile by tile, and that each tile only reads part of the source
+ * @remarks With a focal length of 100 and a baseline of 0.2, depths from 2 to 10 give disparities of 10 to 2
+ * pixels, so a tile only needs a strip of the source a little wider than itself.
+ */
+TEST(TiledMatcher_Test, recover_plane_tiled)
+{
+	// Setup
+	auto size = Size(128, 96);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+
+	Mat referenceImage = SceneUtils::Render(size, 0); Mat referencePose = SceneUtils::GetPose(0);
+	Mat sourceImage = SceneUtils::Render(size, 5); Mat sourcePose = SceneUtils::GetPose(0.2);
+	auto reference = Frame(0, referenceImage, referencePose);
+	auto source = Frame(1, sourceImage, sourcePose);
+	auto sources = vector<Frame *> { &source };
+
+	auto settings = MatchSettings(2.0, 10.0, 3, 4, 4);
+
+	// Execute
+	auto matcher = TiledMatcher(&calibration, &reference, sources, settings, 48, 12);
+	matcher.Run();
+
+	// Confirm
+	ASSERT_EQ(matcher.GetTileCount(), 6);
+	ASSERT_LT(matcher.GetSourcePixels(), (size_t)(6 * size.area()) / 2);
+
+	auto total = 0; auto good = SceneUtils::CountGood(matcher.GetDepth(), 4.0f, total);
+	ASSERT_GT(good, total * 0.9);
+}
+
+/**
+ * @brief Confirm that the source region follows the reference region along the baseline
+ */
+TEST(TiledMatcher_Test, source_region)
+{
+	// Setup
+	auto size = Size(200, 100);
+	auto calibration = SceneUtils::GetCalibration(size, 100);
+
+	Mat image = Mat(size, CV_8UC1, Scalar::all(0)); Mat referencePose = SceneUtils::GetPose(0);
+	Mat sourcePose = SceneUtils::GetPose(0.2);
+	auto reference = Frame(0, image, referencePose);
+	auto source = Frame(1, image, sourcePose);
+	auto sources = vector<Frame *> { &source };
+	auto settings = MatchSettings(2.0, 10.0, 3, 1, 1);
+	auto matcher = TiledMatcher(&calibration, &reference, sources, settings, 50, 0);
+
+	// Execute
+	auto region = matcher.GetSourceRegion(&source, Rect(100, 25, 50, 50));
+
+	// Confirm (disparities of 2 to 10 pixels, padded by 2 * 3 + 8)
+	ASSERT_NEAR(region.x, 100 + 2 - 14, 1);
+	ASSERT_NEAR(region.x + region.width, 149 + 10 + 14 + 1, 2);
+	ASSERT_NEAR(region.y, 25 - 14, 1);
+	ASSERT_NEAR(region.y + region.height, 74 + 14 + 1, 2);
+}
@@ -0,0 +1,137 @@
+//--------------------------------------------------
+// Unit Tests for the voxel hash
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <PatchMatchLib/VoxelHash.h>
+using namespace NVL_App;
+
+//--------------------------------------------------
+// Test Methods
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that points within a voxel are averaged, and that points in other voxels are kept apart
+ */
+TEST(VoxelHash_Test, merge_points)
+{
+	// Setup
+	auto voxels = VoxelHash(0.05);
+
+	// Execute
+	voxels.Add(Vec3d(0.01, 0.01, 0.01), Vec3b(10, 20, 30));
+	voxels.Add(Vec3d(0.03, 0.02, 0.04), Vec3b(30, 40, 50));
+	voxels.Add(Vec3d(-0.01, 0.01, 0.01), Vec3b(0, 0, 0));
+
+	// Confirm
+	vector<Vec3f> points; vector<Vec3b> colours; voxels.GetPoints(points, colours);
+	ASSERT_EQ(voxels.GetCount(), (size_t)2);
+
+	auto found = false;
+	for (auto i = 0; i < (int)points.size(); i++)
+	{
+		if (points[i][0] < 0) continue;
+		found = true;
+		ASSERT_NEAR(points[i][0], 0.02, 1e-6); ASSERT_NEAR(points[i][1], 0.015, 1e-6); ASSERT_NEAR(points[i][2], 0.025, 1e-6);
+		ASSERT_EQ(colours[i], Vec3b(20, 30, 40));
+	}
+	ASSERT_TRUE(found);
+}
+
+/**
+ * @brief Confirm that no points are lost when many threads add to the same voxels
+ */
+TEST(VoxelHash_Test, concurrent_insert)
+{
+	// Setup
+	auto voxels = VoxelHash(1.0);
+	setNumThreads(4);
+
+	// Execute
+	parallel_for_(Range(0, 40), [&](const Range& range)
+	{
+		for (auto i = range.start; i < range.end; i++)
+		{
+			vector<Vec3d> points; vector<Vec3b> colours;
+			for (auto cell = 0; cell < 1000; cell++) { points.push_back(Vec3d(cell % 10 + 0.5, (cell / 10) % 10 + 0.5, cell / 100 + 0.5)); colours.push_back(Vec3b(1, 2, 3)); }
+			voxels.Add(points, colours);
+		}
+	});
+	setNumThreads(-1);
+
+	// Confirm
+	vector<Vec3f> points; vector<Vec3b> colours; voxels.GetPoints(points, colours);
+	ASSERT_EQ(points.size(), (size_t)1000);
+	for (auto& point : points)
+	{
+		for (auto axis = 0; axis < 3; axis++) ASSERT_NEAR(point[axis] - floor(point[axis]), 0.5, 1e-6);
+	}
+}
+
+/**
+ * @brief Confirm that voxels whose indices agree in their low bits are still kept apart
+ */
+TEST(VoxelHash_Test, distant_voxels)
+{
+	// Setup
+	auto voxels = VoxelHash(1.0); auto far = (double)(1ll << 21);
+
+	// Execute
+	voxels.Add(Vec3d(0.5, 0.5, 0.5), Vec3b(10, 10, 10));
+	voxels.Add(Vec3d(far + 0.5, 0.5, 0.5), Vec3b(20, 20, 20));
+	voxels.Add(Vec3d(0.5 - far, 0.5, 0.5), Vec3b(30, 30, 30));
+	voxels.Add(Vec3d(0.5, far + 0.5, 0.5), Vec3b(40, 40, 40));
+	voxels.Add(Vec3d(0.5, 0.5, 4 * far + 0.5), Vec3b(50, 50, 50));
+
+	// Confirm
+	vector<Vec3f> points; vector<Vec3b> colours; voxels.GetPoints(points, colours);
+	ASSERT_EQ(voxels.GetCount(), (size_t)5);
+	auto values = vector<int>(); for (auto& colour : colours) values.push_back(colour[0]);
+	sort(values.begin(), values.end());
+	ASSERT_EQ(values, vector<int>({ 10, 20, 30, 40, 50 }));
+}
+
+/**
+ * @brief Confirm that the cloud is saved as a binary PLY with one 15 byte vertex per voxel
+ */
+TEST(VoxelHash_Test, save_binary_ply)
+{
+	// Setup
+	auto voxels = VoxelHash(1.0);
+	voxels.Add(Vec3d(0.5, 0.5, 0.5), Vec3b(10, 20, 30));
+	voxels.Add(Vec3d(1.5, 0.5, 0.5), Vec3b(10, 20, 30));
+	auto path = string("voxel_hash_test.ply");
+
+	// Execute
+	voxels.Save(path);
+
+	// Confirm
+	auto reader = ifstream(path, ios::binary);
+	auto line = string(); auto header = 0; auto format = string(); auto count = string();
+	while (getline(reader, line))
+	{
+		header += (int)line.size() + 1;
+		if (line.rfind("format", 0) == 0) format = line;
+		if (line.rfind("element vertex", 0) == 0) count = line;
+		if (line == "end_header") break;
+	}
+
+	reader.seekg(0, ios::end); auto length = (int)reader.tellg(); reader.seekg(header);
+	float point[3]; uchar colour[3];
+	reader.read((char *)point, sizeof(point)); reader.read((char *)colour, sizeof(colour));
+	reader.close(); remove(path.c_str());
+
+	ASSERT_EQ(format, "format binary_little_endian 1.0");
+	ASSERT_EQ(count, "element vertex 2");
+	ASSERT_EQ(length, header + 2 * 15);
+	ASSERT_NEAR(point[1], 0.5f, 1e-6f);
+	ASSERT_EQ(colour[0], 30); ASSERT_EQ(colour[2], 10);
+}
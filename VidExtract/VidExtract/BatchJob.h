@@ -0,0 +1,36 @@
+//--------------------------------------------------
+// Model: The outcome of extracting a single video within a batch
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+namespace NVL_Module
+{
+	class BatchJob
+	{
+	private:
+		string _videoFile;
+		string _uniqueName;
+		bool _success;
+		double _seconds;
+		double _inputBytes;
+		double _outputBytes;
+	public:
+		BatchJob() : _success(false), _seconds(0), _inputBytes(0), _outputBytes(0) {}
+		BatchJob(const string& videoFile, const string& uniqueName) : _videoFile(videoFile), _uniqueName(uniqueName), _success(false), _seconds(0), _inputBytes(0), _outputBytes(0) {}
+
+		inline string& GetVideoFile() { return _videoFile; }
+		inline string& GetUniqueName() { return _uniqueName; }
+		inline bool& GetSuccess() { return _success; }
+		inline double& GetSeconds() { return _seconds; }
+		inline double& GetInputBytes() { return _inputBytes; }
+		inline double& GetOutputBytes() { return _outputBytes; }
+	};
+}
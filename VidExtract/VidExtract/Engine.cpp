@@ -43,10 +43,12 @@ void Engine::Run()
     // Setup
     auto path = string("../VidExtractLib/libVidExtractLib.so");
     auto loader = DLLoader<ModuleBase>(path);
+    auto videos = vector<string>();
 
     // Execute
     loader.DLOpenLib();
-    PerformExecute(loader);
+    if (GetBatch(videos)) RunBatch(loader, videos);
+    else PerformExecute(loader, _parameters, _logger);
     loader.DLCloseLib();
 }
 
@@ -57,11 +59,173 @@ void Engine::Run()
 /**
  * @brief Perform the module execution life cycle
  * @param loader The loader that we are using to launch the module
+ * @param parameters The parameters that the module is initialized with
+ * @param logger The logger that the module writes to
+ * @return int The result code of the module execution
  */
-void Engine::PerformExecute(DLLoader<ModuleBase>& loader) 
+int Engine::PerformExecute(DLLoader<ModuleBase>& loader, NVLib::Parameters * parameters, LoggerBase * logger) 
 {
     auto module = loader.DLGetInstance();
-    module->SetLogger(_logger);
-    module->Initialize(*_parameters);
-    module->Execute();
+    module->SetLogger(logger);
+    module->Initialize(*parameters);
+    return module->Execute();
+}
+
+//--------------------------------------------------
+// Batch Execution
+//--------------------------------------------------
+
+/**
+ * @brief Find the videos of a batch, if the input is a folder of videos or a list file (.txt)
+ * @param videos The videos that were found
+ * @return true If the input describes a batch
+ * @return false If the input is a single video
+ */
+bool Engine::GetBatch(vector<string>& videos) 
+{
+    auto input = _parameters->Get("video_file");
+
+    if (filesystem::is_directory(input)) 
+    {
+        auto extensions = vector<string> { ".mp4", ".mov", ".avi", ".mkv", ".m4v", ".mts" };
+        for (auto& entry : filesystem::directory_iterator(input)) 
+        {
+            auto extension = entry.path().extension().string();
+            transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+            if (entry.is_regular_file() && find(extensions.begin(), extensions.end(), extension) != extensions.end()) videos.push_back(entry.path().string());
+        }
+        sort(videos.begin(), videos.end());
+        return true;
+    }
+
+    if (filesystem::path(input).extension() == ".txt") 
+    {
+        auto reader = ifstream(input); if (!reader.is_open()) throw runtime_error("Unable to open: " + input);
+        auto line = string(); 
+        while (getline(reader, line)) if (!line.empty() && line[0] != '#') videos.push_back(line);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Extract several videos at once under a single thread budget
+ * @param loader The loader that we are using to launch the modules
+ * @param videos The videos that we are extracting
+ * @remarks The budget is shared through the module library, so the encoders of every job draw on the same pool.
+ */
+void Engine::RunBatch(DLLoader<ModuleBase>& loader, vector<string>& videos) 
+{
+    if (_parameters->Get("output") == "stream") throw runtime_error("The stream output takes a single video, not a batch");
+
+    auto budget = NVLib::StringUtils::String2Int(_parameters->Get("thread_budget"));
+    if (budget <= 0) budget = max(1, (int)thread::hardware_concurrency());
+    auto jobCount = NVLib::StringUtils::String2Int(_parameters->Get("jobs"));
+    if (jobCount <= 0) jobCount = max(1, budget / 4);
+    jobCount = min(jobCount, (int)videos.size());
+    auto segments = max(1, budget / (2 * max(jobCount, 1)));
+
+    (*_logger) << "Batch: " << videos.size() << " videos, " << jobCount << " jobs, " << budget << " threads" << LoggerBase::End();
+    _parameters->Add("thread_budget", to_string(budget));
+
+    auto uniqueName = _parameters->Get("unique_name");
+    auto jobs = vector<BatchJob>();
+    for (auto& video : videos) jobs.push_back(BatchJob(video, uniqueName + "_" + filesystem::path(video).stem().string()));
+
+    auto start = chrono::steady_clock::now();
+
+    auto next = atomic<int>(0); auto workers = vector<thread>();
+    for (auto i = 0; i < jobCount; i++) 
+    {
+        workers.push_back(thread([&] 
+        {
+            for (auto index = next++; index < (int)jobs.size(); index = next++) RunJob(loader, jobs[index], budget, segments);
+        }));
+    }
+    for (auto& worker : workers) worker.join();
+
+    auto seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    ShowSummary(jobs, seconds);
+}
+
+/**
+ * @brief Extract a single video of the batch
+ * @param loader The loader that we are using to launch the module
+ * @param job The job that we are running
+ * @param threads The number of encoder threads of the job (gated by the shared budget)
+ * @param segments The number of segments the job decodes in parallel
+ */
+void Engine::RunJob(DLLoader<ModuleBase>& loader, BatchJob& job, int threads, int segments) 
+{
+    auto logger = Logger("(" + job.GetUniqueName() + ") ");
+
+    auto keys = vector<string>(); _parameters->GetKeys(keys);
+    auto parameters = NVLib::Parameters(); for (auto& key : keys) parameters.Add(key, _parameters->Get(key));
+    parameters.Add("video_file", job.GetVideoFile());
+    parameters.Add("unique_name", job.GetUniqueName());
+    parameters.Add("threads", to_string(threads));
+    if (NVLib::StringUtils::String2Int(_parameters->Get("segments")) <= 0) parameters.Add("segments", to_string(segments));
+
+    auto start = chrono::steady_clock::now();
+
+    try 
+    {
+        job.GetSuccess() = PerformExecute(loader, &parameters, &logger) == EXIT_SUCCESS;
+    }
+    catch (runtime_error exception) 
+    {
+        logger << "Error: " << exception.what() << LoggerBase::End();
+    }
+    catch (string exception) 
+    {
+        logger << "Error: " << exception << LoggerBase::End();
+    }
+
+    job.GetSeconds() = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    job.GetInputBytes() = GetSize(job.GetVideoFile());
+
+    auto workingFolder = _parameters->Get("working_folder");
+    auto output = NVLib::FileUtils::PathCombine(workingFolder, job.GetUniqueName());
+    job.GetOutputBytes() = GetSize(output) + GetSize(output + ".zip") + GetSize(output + ".vxp");
+}
+
+/**
+ * @brief Show the throughput of each job of the batch
+ * @param jobs The jobs that were run
+ * @param seconds The wall time of the whole batch
+ */
+void Engine::ShowSummary(vector<BatchJob>& jobs, double seconds) 
+{
+    auto totalBytes = 0.0;
+
+    (*_logger) << "Batch Summary:" << LoggerBase::End();
+    for (auto& job : jobs) 
+    {
+        auto megabytes = job.GetInputBytes() / (1024.0 * 1024.0);
+        auto rate = job.GetSeconds() > 0 ? megabytes / job.GetSeconds() : 0;
+        totalBytes += job.GetInputBytes();
+
+        (*_logger) << (job.GetSuccess() ? "[OK] " : "[FAILED] ") << job.GetVideoFile() 
+            << ": " << job.GetSeconds() << " s, " << megabytes << " MB in (" << rate << " MB/s), " 
+            << job.GetOutputBytes() / (1024.0 * 1024.0) << " MB out" << LoggerBase::End();
+    }
+
+    auto totalRate = seconds > 0 ? totalBytes / (1024.0 * 1024.0) / seconds : 0;
+    (*_logger) << "Batch Total: " << seconds << " s, " << totalRate << " MB/s" << LoggerBase::End();
+}
+
+/**
+ * @brief Retrieve the size of a file, or the combined size of the files in a folder
+ * @param path The path that we are measuring
+ * @return double The size in bytes (zero if the path does not exist)
+ */
+double Engine::GetSize(const string& path) 
+{
+    if (filesystem::is_regular_file(path)) return (double)filesystem::file_size(path);
+    if (!filesystem::is_directory(path)) return 0;
+
+    auto result = 0.0;
+    for (auto& entry : filesystem::recursive_directory_iterator(path)) if (entry.is_regular_file()) result += (double)entry.file_size();
+    return result;
 }
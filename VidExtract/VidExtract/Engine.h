@@ -8,15 +8,25 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+#include <thread>
+#include <filesystem>
 #include <iostream>
 using namespace std;
 
+#include <NVLib/FileUtils.h>
+#include <NVLib/StringUtils.h>
 #include <NVLib/Parameters/ParameterLoader.h>
 
 #include <ModuleLib/LoggerBase.h>
 #include <ModuleLib/ModuleBase.h>
 
 #include "DLLoader.h"
+#include "Logger.h"
+#include "BatchJob.h"
 
 namespace NVL_Module
 {
@@ -31,6 +41,12 @@ namespace NVL_Module
 
 		void Run();
 	private:
-		void PerformExecute(DLLoader<ModuleBase>& loader);
+		int PerformExecute(DLLoader<ModuleBase>& loader, NVLib::Parameters * parameters, LoggerBase * logger);
+
+		bool GetBatch(vector<string>& videos);
+		void RunBatch(DLLoader<ModuleBase>& loader, vector<string>& videos);
+		void RunJob(DLLoader<ModuleBase>& loader, BatchJob& job, int threads, int segments);
+		void ShowSummary(vector<BatchJob>& jobs, double seconds);
+		double GetSize(const string& path);
 	};
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <sstream>
 #include <iostream>
 using namespace std;
@@ -19,10 +20,26 @@ namespace NVL_Module
 {
 	class Logger : public LoggerBase
 	{
+    private:
+        string _prefix;
+    public:
+        Logger(const string& prefix = string()) : _prefix(prefix) {}
+
         virtual void Write(const string& message) override 
         {
+            static mutex writeLock; auto guard = lock_guard<mutex>(writeLock);
             auto dateString = NVLib::StringUtils::GetDateTimeString();
-            cout << "[" << dateString << "] " << message << endl;
+            *GetStream() << "[" << dateString << "] " << _prefix << message << endl;
         } 
+
+        /**
+         * @brief The stream that every logger writes to (stderr when the frames are streamed to stdout)
+         * @return ostream*& The stream
+         */
+        static ostream *& GetStream() 
+        {
+            static ostream * stream = &cout;
+            return stream;
+        }
  	};
 }
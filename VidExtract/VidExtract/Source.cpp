@@ -6,12 +6,16 @@
 // @date: 2022-03-24
 //--------------------------------------------------
 
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
 #include "Logger.h"
 #include "Engine.h"
 
 //--------------------------------------------------
 // Function Prototypes
 //--------------------------------------------------
+string GetParamKeys();
 NVLib::Parameters * GetParameters(int argc, char ** argv);
 
 //--------------------------------------------------
@@ -30,6 +34,7 @@ int main(int argc, char ** argv)
     try
     {
         auto parameters = GetParameters(argc, argv);
+        if (parameters->Get("output") == "stream" && parameters->Get("stream_target") == "-") NVL_Module::Logger::GetStream() = &cerr;
         NVL_Module::Engine(parameters, &logger).Run();
     }
     catch (runtime_error exception)
@@ -50,6 +55,49 @@ int main(int argc, char ** argv)
 // Retrieve the parameters
 //--------------------------------------------------
 
+/**
+ * Generate the parameter definition
+ * @return The parameter definition as a string
+ */
+string GetParamKeys() 
+{
+    const char * keys = 
+        "{help h usage ? |                       | Show help message }"
+        "{@video_file    |                       | The video (or folder of videos / .txt list for a batch) to extract from }"
+        "{@frame_step    | 1                     | The number of frames between extracted frames }"
+        "{@working_folder| Output                | The folder that the output is written to }"
+        "{@unique_name   |                       | A unique name for the output file }"
+        "{seek_mode      | auto                  | How to move between frames (auto, grab or seek) }"
+        "{gop_size       | 250                   | The estimated keyframe interval of the video }"
+        "{quality        | 95                    | The JPEG quality of the extracted frames }"
+        "{threads        | 0                     | The number of encoder threads (0 for all but one core) }"
+        "{queue_size     | 16                    | The number of decoded frames that may wait for an encoder }"
+        "{segments       | 0                     | The number of time segments decoded in parallel (0 for half the cores) }"
+        "{output         | zip                   | Where the frames go (zip, pack, folder or stream) }"
+        "{selection      | step                  | How frames are selected (step or parallax) }"
+        "{min_parallax   | 0.05                  | The median flow (fraction of the width) before a parallax frame is kept }"
+        "{sharpness      | none                  | Blur handling (none, reject or window) }"
+        "{min_sharpness  | 100                   | The Laplacian variance below which a frame is rejected }"
+        "{sharp_window   | 2                     | Frames either side of a sampling point searched for the sharpest }"
+        "{jobs           | 0                     | The number of videos extracted at once in a batch (0 for a quarter of the budget) }"
+        "{thread_budget  | 0                     | The number of encoder threads shared by all extractions (0 for unlimited, or all cores in a batch) }"
+        "{io_slots       | 0                     | The number of frames written at once across all extractions (0 for unlimited) }"
+        "{calibration    |                       | A Calibration.xml used to undistort the frames before encoding (none by default) }"
+        "{focal          | 0                     | The focal length of the undistorted frames (0 for the calibrated focal length) }"
+        "{crop_ratio     | 1                     | The fraction of the undistorted frame kept around the center }"
+        "{resize_width   | 0                     | The width that undistorted frames are resized to (0 to keep the size) }"
+        "{resume         | true                  | Continue from the manifest of an interrupted run with the same settings }"
+        "{report_interval| 5                     | The seconds between METRICS progress lines (0 for none) }"
+        "{stream_target  | -                     | Where the stream output goes (- for stdout, or a named pipe) }"
+        "{stream_format  | jpeg                  | The payload of the stream output (jpeg or raw) }"
+        "{sampling       | step                  | How frames are sampled (step, interval or list) }"
+        "{interval_ms    | 1000                  | The milliseconds between frames with interval sampling }"
+        "{frame_list     |                       | A file of frame numbers (one per line) for list sampling }"
+        "{frame_index    | false                 | Index the packets of the video for exact seeks (always on for interval and list) }";
+
+    return string(keys);
+}
+
 /**
  * @brief Retrieve the parameters that we are getting
  * @param argc The number of arguments
@@ -58,13 +106,44 @@ int main(int argc, char ** argv)
  */
 NVLib::Parameters * GetParameters(int argc, char ** argv) 
 {
-    if (argc != 5) throw runtime_error("USAGE: VidExtract <video_file> <frame_step> <working_folder> <unique_name>"); 
+    auto parser = CommandLineParser(argc, argv, GetParamKeys());
+    parser.about("VidExtract v1.0.0");
+
+    auto videoFile = parser.get<string>(0); auto uniqueName = parser.get<string>(3);
+    if (videoFile == string() || uniqueName == string()) throw runtime_error("USAGE: VidExtract <video_file> <frame_step> <working_folder> <unique_name> [options]"); 
 
     auto parameters = new NVLib::Parameters();
-    parameters->Add("video_file", argv[1]);
-    parameters->Add("frame_step", argv[2]);
-    parameters->Add("working_folder", argv[3]);
-    parameters->Add("unique_name", argv[4]);
+    parameters->Add("video_file", videoFile);
+    parameters->Add("frame_step", parser.get<string>(1));
+    parameters->Add("working_folder", parser.get<string>(2));
+    parameters->Add("unique_name", uniqueName);
+    parameters->Add("seek_mode", parser.get<string>("seek_mode"));
+    parameters->Add("gop_size", parser.get<string>("gop_size"));
+    parameters->Add("quality", parser.get<string>("quality"));
+    parameters->Add("threads", parser.get<string>("threads"));
+    parameters->Add("queue_size", parser.get<string>("queue_size"));
+    parameters->Add("segments", parser.get<string>("segments"));
+    parameters->Add("output", parser.get<string>("output"));
+    parameters->Add("selection", parser.get<string>("selection"));
+    parameters->Add("min_parallax", parser.get<string>("min_parallax"));
+    parameters->Add("sharpness", parser.get<string>("sharpness"));
+    parameters->Add("min_sharpness", parser.get<string>("min_sharpness"));
+    parameters->Add("sharp_window", parser.get<string>("sharp_window"));
+    parameters->Add("jobs", parser.get<string>("jobs"));
+    parameters->Add("thread_budget", parser.get<string>("thread_budget"));
+    parameters->Add("io_slots", parser.get<string>("io_slots"));
+    parameters->Add("calibration", parser.get<string>("calibration"));
+    parameters->Add("focal", parser.get<string>("focal"));
+    parameters->Add("crop_ratio", parser.get<string>("crop_ratio"));
+    parameters->Add("resize_width", parser.get<string>("resize_width"));
+    parameters->Add("resume", parser.get<string>("resume"));
+    parameters->Add("report_interval", parser.get<string>("report_interval"));
+    parameters->Add("stream_target", parser.get<string>("stream_target"));
+    parameters->Add("stream_format", parser.get<string>("stream_format"));
+    parameters->Add("sampling", parser.get<string>("sampling"));
+    parameters->Add("interval_ms", parser.get<string>("interval_ms"));
+    parameters->Add("frame_list", parser.get<string>("frame_list"));
+    parameters->Add("frame_index", parser.get<string>("frame_index"));
 
     return parameters;
-}
\ No newline at end of file
+}
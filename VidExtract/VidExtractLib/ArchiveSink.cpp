@@ -0,0 +1,92 @@
+//--------------------------------------------------
+// Implementation of class ArchiveSink
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ArchiveSink.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the archive that we are writing
+ */
+ArchiveSink::ArchiveSink(const string& path) : _writer(path)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Resume Constructor
+ * @param path The path to the archive that an earlier run left unfinished
+ * @param entries The frames that the manifest records (trimmed to those that are still intact)
+ */
+ArchiveSink::ArchiveSink(const string& path, vector<ManifestEntry>& entries) : _writer(path, Keep(path, entries))
+{
+	// Extra implementation can go here
+}
+
+//--------------------------------------------------
+// Resume
+//--------------------------------------------------
+
+/**
+ * @brief Find the entries of an unfinished archive that can be kept
+ * @param path The path to the archive
+ * @param entries The frames that the manifest records (trimmed to those that are kept)
+ * @return vector<ZipEntry> The kept entries
+ * @remarks Entries must follow each other and lie within the file; the checksum of the last one is
+ * confirmed, since that is the one a crash would have cut short.
+ */
+vector<ZipEntry> ArchiveSink::Keep(const string& path, vector<ManifestEntry>& entries)
+{
+	auto error = error_code(); auto fileSize = filesystem::file_size(path, error);
+	if (error) fileSize = 0;
+
+	auto result = vector<ZipEntry>(); auto offset = (uint64_t)0;
+	for (auto& entry : entries)
+	{
+		auto end = offset + 30 + entry.GetName().size() + entry.GetSize();
+		if (entry.GetOffset() != offset || end > fileSize) break;
+		result.push_back(ZipEntry(entry.GetName(), entry.GetCrc(), entry.GetSize(), offset)); offset = end;
+	}
+
+	if (!result.empty()) 
+	{
+		auto& last = result.back();
+		if (!FrameManifest::CheckData(path, last.GetOffset() + 30 + last.GetName().size(), last.GetSize(), last.GetCrc())) result.pop_back();
+	}
+
+	entries.erase(entries.begin() + result.size(), entries.end());
+	return result;
+}
+
+//--------------------------------------------------
+// Write
+//--------------------------------------------------
+
+/**
+ * @brief Add the encoded frame to the archive as a stored entry (JPEG data does not compress further)
+ * @param packet The packet that we are writing
+ * @remarks The data is flushed so that the manifest never runs ahead of the file.
+ */
+void ArchiveSink::Write(FramePacket * packet)
+{
+	auto& buffer = packet->GetBuffer();
+	packet->GetOffset() = _writer.Add(FolderSink::GetFileName(packet->GetIndex()), buffer.data(), buffer.size(), packet->GetCrc());
+	_writer.Flush();
+}
+
+/**
+ * @brief Write the central directory of the archive
+ */
+void ArchiveSink::Close()
+{
+	_writer.Close();
+}
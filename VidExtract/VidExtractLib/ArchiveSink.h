@@ -0,0 +1,34 @@
+//--------------------------------------------------
+// Sink: Streams each encoded frame straight into a zip archive
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include "FrameSink.h"
+#include "FolderSink.h"
+#include "ZipWriter.h"
+#include "FrameManifest.h"
+
+namespace NVL_Module
+{
+	class ArchiveSink : public FrameSink
+	{
+	private:
+		ZipWriter _writer;
+	public:
+		ArchiveSink(const string& path);
+		ArchiveSink(const string& path, vector<ManifestEntry>& entries);
+
+		virtual void Write(FramePacket * packet) override;
+		virtual void Close() override;
+	private:
+		static vector<ZipEntry> Keep(const string& path, vector<ManifestEntry>& entries);
+	};
+}
@@ -0,0 +1,92 @@
+//--------------------------------------------------
+// Utility: A bounded queue that blocks producers when full and consumers when empty
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <queue>
+#include <mutex>
+#include <condition_variable>
+#include <iostream>
+using namespace std;
+
+namespace NVL_Module
+{
+	template<class T>
+	class BlockingQueue
+	{
+	private:
+		queue<T> _items;
+		size_t _capacity;
+		bool _closed;
+		mutex _lock;
+		condition_variable _notFull;
+		condition_variable _notEmpty;
+	public:
+
+		/**
+		 * @brief Main Constructor
+		 * @param capacity The maximum number of items that the queue holds
+		 */
+		BlockingQueue(size_t capacity) : _capacity(capacity), _closed(false)
+		{
+			// Extra implementation can go here
+		}
+
+		/**
+		 * @brief Add an item to the queue, waiting while the queue is full
+		 * @param item The item that we are adding
+		 * @return true If the item was added
+		 * @return false If the queue was closed
+		 */
+		bool Push(const T& item)
+		{
+			auto guard = unique_lock<mutex>(_lock);
+			_notFull.wait(guard, [this] { return _closed || _items.size() < _capacity; });
+			if (_closed) return false;
+			_items.push(item);
+			_notEmpty.notify_one();
+			return true;
+		}
+
+		/**
+		 * @brief Remove an item from the queue, waiting while the queue is empty
+		 * @param item The item that was removed
+		 * @return true If an item was removed
+		 * @return false If the queue is closed and has been drained
+		 */
+		bool Pop(T& item)
+		{
+			auto guard = unique_lock<mutex>(_lock);
+			_notEmpty.wait(guard, [this] { return _closed || !_items.empty(); });
+			if (_items.empty()) return false;
+			item = _items.front(); _items.pop();
+			_notFull.notify_one();
+			return true;
+		}
+
+		/**
+		 * @brief Indicate that no more items will be added
+		 */
+		void Close()
+		{
+			auto guard = unique_lock<mutex>(_lock);
+			_closed = true;
+			_notFull.notify_all(); _notEmpty.notify_all();
+		}
+
+		/**
+		 * @brief Retrieve the number of items waiting in the queue
+		 * @return size_t The number of items
+		 */
+		size_t Size()
+		{
+			auto guard = unique_lock<mutex>(_lock);
+			return _items.size();
+		}
+	};
+}
@@ -0,0 +1,56 @@
+//--------------------------------------------------
+// Implementation of class Calibration
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "Calibration.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Custom Constructor
+ * @param camera The camera matrix
+ * @param distortion The distortion coefficients
+ * @param size The size of the images that this calibration describes
+ */
+Calibration::Calibration(Mat& camera, Mat& distortion, const Size& size) : _camera(camera), _distortion(distortion), _imageSize(size)
+{
+	// Extra Implementation
+}
+
+/**
+ * @brief Custom Constructor
+ * @param path The path to the calibration file (Calibration.xml)
+ */
+Calibration::Calibration(const string& path)
+{
+	auto reader = FileStorage(path, FileStorage::FORMAT_XML | FileStorage::READ);
+	if (!reader.isOpened()) throw runtime_error("Unable to open: " + path);
+	reader["camera"] >> _camera; reader["distortion"] >> _distortion; reader["image_size"] >> _imageSize;
+	reader.release();
+
+	if (_camera.rows != 3 || _camera.cols != 3 || _imageSize.area() == 0) throw runtime_error("Invalid calibration: " + path);
+	_camera.convertTo(_camera, CV_64F);
+}
+
+//--------------------------------------------------
+// Save
+//--------------------------------------------------
+
+/**
+ * @brief Write the calibration in the same layout that it is loaded from
+ * @param path The path to the calibration file
+ */
+void Calibration::Save(const string& path)
+{
+	auto writer = FileStorage(path, FileStorage::FORMAT_XML | FileStorage::WRITE);
+	if (!writer.isOpened()) throw runtime_error("Unable to open: " + path);
+	writer << "camera" << _camera << "distortion" << _distortion << "image_size" << _imageSize;
+	writer.release();
+}
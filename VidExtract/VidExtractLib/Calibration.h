@@ -0,0 +1,35 @@
+//--------------------------------------------------
+// Model: The intrinsic calibration of the camera that recorded the video
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_Module
+{
+	class Calibration
+	{
+	private:
+		Mat _camera;
+		Mat _distortion;
+		Size _imageSize;
+	public:
+		Calibration(Mat& camera, Mat& distortion, const Size& size);
+		Calibration(const string& path);
+
+		void Save(const string& path);
+
+		inline Mat& GetCamera() { return _camera; }
+		inline Mat& GetDistortion() { return _distortion; }
+		inline Size& GetImageSize() { return _imageSize; }
+	};
+}
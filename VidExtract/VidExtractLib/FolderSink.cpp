@@ -0,0 +1,81 @@
+//--------------------------------------------------
+// Implementation of class FolderSink
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "FolderSink.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param folder The folder that we are writing to
+ */
+FolderSink::FolderSink(const string& folder) : _folder(folder)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Resume Constructor
+ * @param folder The folder that an earlier run left unfinished
+ * @param entries The frames that the manifest records (trimmed to those that are still intact)
+ * @remarks Files must exist with the recorded size; the checksum of the last one is confirmed.
+ */
+FolderSink::FolderSink(const string& folder, vector<ManifestEntry>& entries) : _folder(folder)
+{
+	auto kept = size_t(0);
+	for (auto& entry : entries) 
+	{
+		auto error = error_code(); auto size = filesystem::file_size(NVLib::FileUtils::PathCombine(folder, entry.GetName()), error);
+		if (error || size != entry.GetSize()) break;
+		kept++;
+	}
+
+	if (kept > 0) 
+	{
+		auto& last = entries[kept - 1];
+		if (!FrameManifest::CheckData(NVLib::FileUtils::PathCombine(folder, last.GetName()), 0, last.GetSize(), last.GetCrc())) kept--;
+	}
+
+	entries.erase(entries.begin() + kept, entries.end());
+}
+
+//--------------------------------------------------
+// Write
+//--------------------------------------------------
+
+/**
+ * @brief Write the encoded frame to disk
+ * @param packet The packet that we are writing
+ */
+void FolderSink::Write(FramePacket * packet)
+{
+	auto path = NVLib::FileUtils::PathCombine(_folder, GetFileName(packet->GetIndex()));
+
+	auto writer = ofstream(path, ios::binary);
+	if (!writer.is_open()) throw runtime_error("Unable to open: " + path);
+	writer.write((const char *) packet->GetBuffer().data(), packet->GetBuffer().size());
+	writer.close();
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the name of the file for the given output index
+ * @param index The output index
+ * @return string The resultant file name
+ */
+string FolderSink::GetFileName(int index)
+{
+	auto fileName = stringstream(); fileName << "image_" << setw(4) << setfill('0') << index << ".jpg";
+	return fileName.str();
+}
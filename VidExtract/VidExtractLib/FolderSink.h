@@ -0,0 +1,34 @@
+//--------------------------------------------------
+// Sink: Writes each encoded frame to a file within a folder
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+#include <NVLib/FileUtils.h>
+
+#include "FrameSink.h"
+#include "FrameManifest.h"
+
+namespace NVL_Module
+{
+	class FolderSink : public FrameSink
+	{
+	private:
+		string _folder;
+	public:
+		FolderSink(const string& folder);
+		FolderSink(const string& folder, vector<ManifestEntry>& entries);
+
+		virtual void Write(FramePacket * packet) override;
+
+		static string GetFileName(int index);
+	};
+}
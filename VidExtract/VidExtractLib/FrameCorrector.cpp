@@ -0,0 +1,68 @@
+//--------------------------------------------------
+// Implementation of class FrameCorrector
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "FrameCorrector.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param calibration The calibration of the video (owned by the corrector)
+ * @param focal The focal length of the ideal camera (0 to use the mean of the calibrated focal lengths)
+ * @param cropRatio The fraction of the width and height that is kept around the center
+ * @param width The width of the output frames (0 to keep the cropped width)
+ * @remarks The crop and the resize are folded into the camera matrix of the ideal camera, so the maps
+ * take each output pixel straight back to the distorted frame and all three steps cost one remap.
+ */
+FrameCorrector::FrameCorrector(Calibration * calibration, double focal, double cropRatio, int width) : _calibration(calibration)
+{
+	if (cropRatio <= 0 || cropRatio > 1) throw runtime_error("The crop ratio must be in (0, 1]");
+
+	auto& camera = calibration->GetCamera(); auto& size = calibration->GetImageSize();
+	if (focal <= 0) focal = (camera.at<double>(0, 0) + camera.at<double>(1, 1)) * 0.5;
+
+	auto cropWidth = size.width * cropRatio; auto cropHeight = size.height * cropRatio;
+	auto scale = width > 0 ? width / cropWidth : 1.0;
+	auto outputSize = Size((int)round(cropWidth * scale), (int)round(cropHeight * scale));
+
+	Mat outputCamera = (Mat_<double>(3,3) << focal * scale, 0, outputSize.width * 0.5, 0, focal * scale, outputSize.height * 0.5, 0, 0, 1);
+	Mat outputDistortion = (Mat_<double>(4,1) << 0, 0, 0, 0);
+	_output = new Calibration(outputCamera, outputDistortion, outputSize);
+
+	initUndistortRectifyMap(camera, calibration->GetDistortion(), Mat(), outputCamera, outputSize, CV_16SC2, _map1, _map2);
+}
+
+/**
+ * @brief Main Terminator
+ */
+FrameCorrector::~FrameCorrector()
+{
+	delete _calibration; delete _output;
+}
+
+//--------------------------------------------------
+// Apply
+//--------------------------------------------------
+
+/**
+ * @brief Correct a decoded frame (safe to call from several threads at once)
+ * @param image The frame that is replaced with its corrected form
+ * @remarks A frame that arrives in portrait against a landscape calibration is rotated first, as FixPhoto does.
+ */
+void FrameCorrector::Apply(Mat& image)
+{
+	auto& size = _calibration->GetImageSize();
+	if (image.cols == size.height && image.rows == size.width && size.width != size.height) rotate(image, image, ROTATE_90_CLOCKWISE);
+	if (image.size() != size) throw runtime_error("The frames do not match the size of the calibration");
+
+	Mat corrected; remap(image, corrected, _map1, _map2, INTER_LINEAR, BORDER_CONSTANT);
+	image = corrected;
+}
@@ -0,0 +1,36 @@
+//--------------------------------------------------
+// Utility: Undistorts, crops and resizes decoded frames with a single precomputed remap
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Calibration.h"
+
+namespace NVL_Module
+{
+	class FrameCorrector
+	{
+	private:
+		Calibration * _calibration;
+		Calibration * _output;
+		Mat _map1;
+		Mat _map2;
+	public:
+		FrameCorrector(Calibration * calibration, double focal, double cropRatio, int width);
+		~FrameCorrector();
+
+		void Apply(Mat& image);
+
+		inline Calibration * GetOutput() { return _output; }
+	};
+}
@@ -0,0 +1,177 @@
+//--------------------------------------------------
+// Implementation of class FrameIndex
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "FrameIndex.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor (reads every packet of the video once)
+ * @param videoFile The video that we are indexing
+ * @remarks The capture is switched to raw mode (CAP_PROP_FORMAT = -1), so grab() demuxes packets without
+ * decoding them and the pass costs little more than reading the file. The packets arrive in decode order
+ * and are sorted by timestamp, so frame i of the index is the i-th frame that the decoder returns.
+ */
+FrameIndex::FrameIndex(const string& videoFile)
+{
+	auto capture = VideoCapture(videoFile, CAP_FFMPEG);
+	if (!capture.isOpened()) throw runtime_error("Unable to open: " + videoFile);
+	if (!capture.set(CAP_PROP_FORMAT, -1)) throw runtime_error("Unable to read the packets of: " + videoFile);
+
+	auto packets = vector<tuple<double, uint8_t, uint64_t>>(); Mat packet;
+	while (capture.grab())
+	{
+		capture.retrieve(packet);
+		auto keyframe = capture.get(CAP_PROP_LRF_HAS_KEY_FRAME) != 0;
+		packets.push_back(make_tuple(capture.get(CAP_PROP_POS_MSEC), (uint8_t)keyframe, (uint64_t)(packet.total() * packet.elemSize())));
+	}
+
+	stable_sort(packets.begin(), packets.end(), [](auto& a, auto& b) { return get<0>(a) < get<0>(b); });
+
+	auto sizes = vector<uint64_t>();
+	for (auto& item : packets) 
+	{
+		_timestamps.push_back(get<0>(item)); _keyframes.push_back(get<1>(item)); sizes.push_back(get<2>(item));
+	}
+
+	Setup(sizes);
+}
+
+/**
+ * @brief Custom Constructor
+ * @param timestamps The timestamps (ms) of the frames in presentation order
+ * @param keyframes Flags marking the frames that decoding can start from
+ * @param sizes The number of bytes in each packet
+ */
+FrameIndex::FrameIndex(vector<double>& timestamps, vector<uint8_t>& keyframes, vector<uint64_t>& sizes) : _timestamps(timestamps), _keyframes(keyframes)
+{
+	Setup(sizes);
+}
+
+/**
+ * @brief Build the running byte offsets and the keyframe lookup
+ * @param sizes The number of bytes in each packet
+ * @remarks The first frame is always treated as a keyframe, since a seek to the start is always exact.
+ */
+void FrameIndex::Setup(vector<uint64_t>& sizes)
+{
+	if (!_keyframes.empty()) _keyframes[0] = 1;
+
+	_offsets.assign(1, 0);
+	for (auto size : sizes) _offsets.push_back(_offsets.back() + size);
+
+	_lastKeyframe.resize(_keyframes.size());
+	for (auto i = 0; i < (int)_keyframes.size(); i++) _lastKeyframe[i] = _keyframes[i] ? i : _lastKeyframe[i - 1];
+}
+
+//--------------------------------------------------
+// Cache
+//--------------------------------------------------
+
+/**
+ * @brief Load the index that an earlier run cached
+ * @param videoFile The video that the index describes
+ * @param cachePath The path to the cached index
+ * @return FrameIndex * The index (nullptr if there is no cache or the video changed since)
+ */
+FrameIndex * FrameIndex::Load(const string& videoFile, const string& cachePath)
+{
+	auto reader = ifstream(cachePath);
+	if (!reader.is_open()) return nullptr;
+
+	auto line = string();
+	if (!getline(reader, line) || line != "vxindex 1 " + GetStamp(videoFile)) return nullptr;
+
+	auto timestamps = vector<double>(); auto keyframes = vector<uint8_t>(); auto sizes = vector<uint64_t>();
+	double timestamp; int keyframe; uint64_t size;
+	while (reader >> timestamp >> keyframe >> size) 
+	{
+		timestamps.push_back(timestamp); keyframes.push_back((uint8_t)keyframe); sizes.push_back(size);
+	}
+
+	if (!reader.eof() || timestamps.empty()) return nullptr;
+	return new FrameIndex(timestamps, keyframes, sizes);
+}
+
+/**
+ * @brief Cache the index for later runs
+ * @param videoFile The video that the index describes
+ * @param cachePath The path to the cached index
+ */
+void FrameIndex::Save(const string& videoFile, const string& cachePath)
+{
+	auto writer = ofstream(cachePath);
+	if (!writer.is_open()) throw runtime_error("Unable to open: " + cachePath);
+
+	writer << "vxindex 1 " << GetStamp(videoFile) << "\n" << setprecision(17);
+	for (auto i = 0; i < GetCount(); i++) writer << _timestamps[i] << " " << (int)_keyframes[i] << " " << (_offsets[i + 1] - _offsets[i]) << "\n";
+
+	writer.close();
+	if (writer.fail()) throw runtime_error("Unable to write to: " + cachePath);
+}
+
+/**
+ * @brief Describe the state of the video file, so that a stale cache is ignored
+ * @param videoFile The video that we are describing
+ * @return string The size and modification time of the file
+ */
+string FrameIndex::GetStamp(const string& videoFile)
+{
+	auto error = error_code();
+	auto size = filesystem::file_size(videoFile, error); if (error) return string();
+	auto time = filesystem::last_write_time(videoFile, error); if (error) return string();
+	return to_string(size) + " " + to_string(time.time_since_epoch().count());
+}
+
+//--------------------------------------------------
+// Lookup
+//--------------------------------------------------
+
+/**
+ * @brief Find the frame with the given timestamp
+ * @param timestamp The timestamp (ms) reported by the decoder
+ * @return int The frame (-1 if no frame is closer than half the gap to its neighbours)
+ */
+int FrameIndex::Find(double timestamp)
+{
+	auto frame = FindNearest(timestamp); if (frame < 0) return -1;
+
+	auto gap = numeric_limits<double>::max();
+	if (frame > 0) gap = min(gap, _timestamps[frame] - _timestamps[frame - 1]);
+	if (frame + 1 < GetCount()) gap = min(gap, _timestamps[frame + 1] - _timestamps[frame]);
+
+	return abs(_timestamps[frame] - timestamp) < max(gap * 0.5, 1e-3) ? frame : -1;
+}
+
+/**
+ * @brief Find the frame whose timestamp is closest to the given one
+ * @param timestamp The timestamp (ms) that we are looking for
+ * @return int The frame (-1 if the index is empty)
+ */
+int FrameIndex::FindNearest(double timestamp)
+{
+	if (_timestamps.empty()) return -1;
+
+	auto after = (int)(lower_bound(_timestamps.begin(), _timestamps.end(), timestamp) - _timestamps.begin());
+	if (after == 0) return 0;
+	if (after == GetCount()) return GetCount() - 1;
+	return timestamp - _timestamps[after - 1] <= _timestamps[after] - timestamp ? after - 1 : after;
+}
+
+/**
+ * @brief Retrieve the average distance between keyframes
+ * @return int The number of frames
+ */
+int FrameIndex::GetAverageGop()
+{
+	auto count = 0; for (auto keyframe : _keyframes) count += keyframe;
+	return max(1, GetCount() / max(count, 1));
+}
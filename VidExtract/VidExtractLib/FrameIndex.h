@@ -0,0 +1,57 @@
+//--------------------------------------------------
+// Utility: A one-pass index of the video packets (timestamp, keyframe flag and size) in presentation order
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+#include <tuple>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_Module
+{
+	class FrameIndex
+	{
+	private:
+		vector<double> _timestamps;
+		vector<uint8_t> _keyframes;
+		vector<uint64_t> _offsets;
+		vector<int> _lastKeyframe;
+	public:
+		FrameIndex(const string& videoFile);
+		FrameIndex(vector<double>& timestamps, vector<uint8_t>& keyframes, vector<uint64_t>& sizes);
+
+		static FrameIndex * Load(const string& videoFile, const string& cachePath);
+		void Save(const string& videoFile, const string& cachePath);
+
+		int Find(double timestamp);
+		int FindNearest(double timestamp);
+
+		inline int GetCount() { return (int)_timestamps.size(); }
+		inline double GetTimestamp(int frame) { return _timestamps[frame]; }
+		inline bool IsKeyframe(int frame) { return _keyframes[frame] != 0; }
+		inline int GetKeyframe(int frame) { return _lastKeyframe[frame]; }
+		inline uint64_t GetOffset(int frame) { return _offsets[frame]; }
+		inline uint64_t GetCost(int from, int to) { return to > from ? _offsets[to] - _offsets[from] : 0; }
+		inline double GetAverageSize() { return _timestamps.empty() ? 0 : (double)_offsets.back() / _timestamps.size(); }
+		int GetAverageGop();
+	private:
+		void Setup(vector<uint64_t>& sizes);
+		static string GetStamp(const string& videoFile);
+	};
+}
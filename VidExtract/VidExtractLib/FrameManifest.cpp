@@ -0,0 +1,161 @@
+//--------------------------------------------------
+// Implementation of class FrameManifest
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "FrameManifest.h"
+#include "ZipWriter.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the manifest file
+ * @param settings A single-line description of the settings that change the output (a resumed run must match it)
+ */
+FrameManifest::FrameManifest(const string& path, const string& settings) : _path(path), _settings(settings), _complete(false)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Main Terminator
+ */
+FrameManifest::~FrameManifest()
+{
+	if (_writer.is_open()) _writer.close();
+}
+
+//--------------------------------------------------
+// Loading
+//--------------------------------------------------
+
+/**
+ * @brief Load the manifest left by a previous run
+ * @return true If there was a manifest written with the same settings
+ * @return false If there is nothing to resume from
+ * @remarks The file holds a "settings" line, a "segment <id> <first> <end>" line per segment, a
+ * "frame <segment> <index> <frame> <name> <crc> <size> <offset> <timestamp>" line per written frame (in write order)
+ * and a final "complete" line once the output was closed. A truncated last line is ignored.
+ */
+bool FrameManifest::Load()
+{
+	auto reader = ifstream(_path);
+	if (!reader.is_open()) return false;
+
+	auto line = string(); 
+	if (!getline(reader, line) || line != "settings " + _settings) return false;
+
+	while (getline(reader, line))
+	{
+		auto parser = stringstream(line); auto type = string(); parser >> type;
+
+		if (type == "segment") 
+		{
+			auto id = 0; auto first = 0; auto end = 0;
+			if (!(parser >> id >> first >> end) || id != (int)_ranges.size()) return false;
+			_ranges.push_back(Vec2i(first, end));
+		}
+		else if (type == "frame") 
+		{
+			int segment, index, frame; string name; uint32_t crc; uint64_t size, offset; double timestamp;
+			if (!(parser >> segment >> index >> frame >> name >> hex >> crc >> dec >> size >> offset >> timestamp)) break;
+			if (segment < 0 || segment >= (int)_ranges.size()) return false;
+			_entries.push_back(ManifestEntry(segment, index, frame, name, crc, size, offset, timestamp));
+		}
+		else if (type == "complete") _complete = true;
+		else break;
+	}
+
+	return !_ranges.empty();
+}
+
+//--------------------------------------------------
+// Writing
+//--------------------------------------------------
+
+/**
+ * @brief Rewrite the manifest and keep it open for appending
+ * @param ranges The segments of the extraction
+ * @param entries The frames that are already written (those that survived the checks of the sink)
+ */
+void FrameManifest::Start(vector<Vec2i>& ranges, vector<ManifestEntry>& entries)
+{
+	_ranges = ranges; _entries = entries; _complete = false;
+
+	_writer.open(_path, ios::trunc);
+	if (!_writer.is_open()) throw runtime_error("Unable to open: " + _path);
+
+	_writer << "settings " << _settings << endl;
+	for (auto i = 0; i < (int)_ranges.size(); i++) _writer << "segment " << i << " " << _ranges[i][0] << " " << _ranges[i][1] << endl;
+	for (auto& entry : _entries) WriteEntry(entry);
+	_writer.flush();
+}
+
+/**
+ * @brief Record a frame once the sink has written it
+ * @param packet The packet that was written
+ * @param name The name of the frame within the output
+ */
+void FrameManifest::Append(FramePacket * packet, const string& name)
+{
+	auto guard = lock_guard<mutex>(_lock);
+
+	_entries.push_back(ManifestEntry(packet->GetSegment(), packet->GetIndex(), packet->GetFrame(), name, packet->GetCrc(), packet->GetBuffer().size(), packet->GetOffset(), packet->GetTimestamp()));
+	WriteEntry(_entries.back()); _writer.flush();
+
+	if (!_writer) throw runtime_error("Unable to write to: " + _path);
+}
+
+/**
+ * @brief Record that the output was closed successfully
+ */
+void FrameManifest::MarkComplete()
+{
+	auto guard = lock_guard<mutex>(_lock);
+
+	_complete = true;
+	_writer << "complete" << endl;
+	_writer.close();
+}
+
+/**
+ * @brief Write the line of a frame
+ * @param entry The frame that we are writing
+ */
+void FrameManifest::WriteEntry(ManifestEntry& entry)
+{
+	_writer << "frame " << entry.GetSegment() << " " << entry.GetIndex() << " " << entry.GetFrame() << " " << entry.GetName() << " ";
+	_writer << hex << setw(8) << setfill('0') << entry.GetCrc() << dec << setfill(' ') << " " << entry.GetSize() << " " << entry.GetOffset() << " " << setprecision(17) << entry.GetTimestamp() << "\n";
+}
+
+//--------------------------------------------------
+// Checking
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a frame is stored intact within a file
+ * @param path The file that holds the frame
+ * @param offset The offset of the frame data within the file
+ * @param size The number of bytes in the frame
+ * @param crc The expected checksum
+ * @return true If the data is present and matches the checksum
+ */
+bool FrameManifest::CheckData(const string& path, uint64_t offset, uint64_t size, uint32_t crc)
+{
+	auto error = error_code();
+	auto fileSize = filesystem::file_size(path, error);
+	if (error || offset + size > fileSize) return false;
+
+	auto reader = ifstream(path, ios::binary); reader.seekg(offset);
+	auto data = vector<unsigned char>(size);
+	if (!reader.read((char *) data.data(), size)) return false;
+
+	return ZipWriter::GetCrc32(data.data(), data.size()) == crc;
+}
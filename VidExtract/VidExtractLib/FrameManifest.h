@@ -0,0 +1,55 @@
+//--------------------------------------------------
+// Utility: Records the frames that were written so that an interrupted extraction can resume
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <filesystem>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "ManifestEntry.h"
+#include "FramePacket.h"
+
+namespace NVL_Module
+{
+	class FrameManifest
+	{
+	private:
+		string _path;
+		string _settings;
+		vector<Vec2i> _ranges;
+		vector<ManifestEntry> _entries;
+		bool _complete;
+		mutex _lock;
+		ofstream _writer;
+	public:
+		FrameManifest(const string& path, const string& settings);
+		~FrameManifest();
+
+		bool Load();
+		void Start(vector<Vec2i>& ranges, vector<ManifestEntry>& entries);
+		void Append(FramePacket * packet, const string& name);
+		void MarkComplete();
+
+		static bool CheckData(const string& path, uint64_t offset, uint64_t size, uint32_t crc);
+
+		inline vector<Vec2i>& GetRanges() { return _ranges; }
+		inline vector<ManifestEntry>& GetEntries() { return _entries; }
+		inline bool IsComplete() { return _complete; }
+	private:
+		void WriteEntry(ManifestEntry& entry);
+	};
+}
@@ -0,0 +1,44 @@
+//--------------------------------------------------
+// Model: A frame moving through the extraction pipeline
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_Module
+{
+	class FramePacket
+	{
+	private:
+		int _segment;
+		int _index;
+		int _frame;
+		Mat _image;
+		vector<uchar> _buffer;
+		uint32_t _crc;
+		uint64_t _offset;
+		double _timestamp;
+	public:
+		FramePacket(int segment, int index, int frame, Mat& image) : _segment(segment), _index(index), _frame(frame), _image(image), _crc(0), _offset(0), _timestamp(0) {}
+
+		inline int& GetSegment() { return _segment; }
+		inline int& GetIndex() { return _index; }
+		inline int& GetFrame() { return _frame; }
+		inline Mat& GetImage() { return _image; }
+		inline vector<uchar>& GetBuffer() { return _buffer; }
+		inline uint32_t& GetCrc() { return _crc; }
+		inline uint64_t& GetOffset() { return _offset; }
+		inline double& GetTimestamp() { return _timestamp; }
+		inline size_t GetByteCount() { return _buffer.empty() ? _image.total() * _image.elemSize() : _buffer.size(); }
+	};
+}
@@ -0,0 +1,145 @@
+//--------------------------------------------------
+// Implementation of class FrameReader
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "FrameReader.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define SEEK_COST_FRAMES 4
+#define SEEK_RETRIES 3
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param videoFile The video file that we are reading from
+ * @param seekThreshold The largest forward gap (in frames) that is covered with grab() rather than a seek
+ */
+FrameReader::FrameReader(const string& videoFile, int seekThreshold) : _player(videoFile), _position(0), _grabbed(-1), _seekThreshold(seekThreshold), _seekCount(0), _index(nullptr)
+{
+	// Extra implementation can go here
+}
+
+//--------------------------------------------------
+// Read
+//--------------------------------------------------
+
+/**
+ * @brief Read the given frame from the video
+ * @param frame The index of the frame that we want
+ * @param image The image that was read
+ * @return true If the frame was read
+ * @return false If the end of the video was reached
+ */
+bool FrameReader::Read(int frame, Mat& image)
+{
+	if (_grabbed != frame)
+	{
+		if (!Advance(frame)) return false;
+		if (_grabbed != frame && !Grab()) return false;
+	}
+
+	return _player.retrieve(image) && !image.empty();
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Move the player so that the next grab() returns the given frame (or so that it was just grabbed)
+ * @param frame The frame that we want to move to
+ * @return true If the move was successful
+ * @return false If the end of the video was reached
+ * @remarks Seeking makes the decoder jump back to a keyframe and decode up to the target, so small
+ * forward gaps are cheaper to cover by grabbing (decoding without color conversion) the frames in between.
+ * With an index the choice compares the bytes that each option has to decode, and seeks are exact. The first
+ * read always seeks (whatever the threshold), so a segment that starts part way in never decodes from frame 0.
+ */
+bool FrameReader::Advance(int frame)
+{
+	auto seek = frame < _position || frame - _position > _seekThreshold;
+
+	if (_index != nullptr && frame < _index->GetCount() && _seekThreshold > 0 && _seekThreshold < INT_MAX) 
+	{
+		auto keyframe = _index->GetKeyframe(frame);
+		auto seekCost = _index->GetCost(keyframe, frame) + (uint64_t)(SEEK_COST_FRAMES * _index->GetAverageSize());
+		seek = frame < _position || (keyframe > _position && seekCost < _index->GetCost(_position, frame));
+	}
+
+	if (_grabbed < 0 && frame > _position) seek = true;
+
+	if (seek && !Seek(frame)) return false;
+
+	while (_position < frame)
+	{
+		if (!Grab()) return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Seek so that the given frame is next (or was just grabbed)
+ * @param frame The frame that we are seeking to
+ * @return true If the seek was successful
+ * @return false If the end of the video was reached
+ * @remarks Without an index this trusts the frame-number seek of the backend, which is only an estimate for
+ * variable frame rate video. With an index the seek goes to the keyframe before the target by timestamp, the
+ * frame that is decoded is looked up to find where the decoder really landed, and an overshoot falls back to
+ * an earlier keyframe (and finally to the start of the video).
+ */
+bool FrameReader::Seek(int frame)
+{
+	_seekCount++;
+
+	if (_index == nullptr || frame >= _index->GetCount())
+	{
+		_player.set(CAP_PROP_POS_FRAMES, frame);
+		_position = frame; _grabbed = -1;
+		return true;
+	}
+
+	auto keyframe = _index->GetKeyframe(frame);
+
+	for (auto attempt = 0; attempt < SEEK_RETRIES && keyframe > 0; attempt++) 
+	{
+		_player.set(CAP_PROP_POS_MSEC, _index->GetTimestamp(keyframe));
+		if (!_player.grab()) break;
+
+		auto landed = _index->Find(_player.get(CAP_PROP_POS_MSEC));
+		if (landed >= 0 && landed <= frame) 
+		{
+			_grabbed = landed; _position = landed + 1;
+			return true;
+		}
+
+		keyframe = _index->GetKeyframe(max(keyframe - 1, 0));
+	}
+
+	_player.set(CAP_PROP_POS_FRAMES, 0);
+	_position = 0; _grabbed = -1;
+	return true;
+}
+
+/**
+ * @brief Grab the next frame
+ * @return true If a frame was grabbed
+ * @return false If the end of the video was reached
+ */
+bool FrameReader::Grab()
+{
+	if (!_player.grab()) return false;
+	_grabbed = _position++;
+	return true;
+}
@@ -0,0 +1,48 @@
+//--------------------------------------------------
+// Utility: Reads frames from a video, choosing between grabbing and seeking
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <climits>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "FrameIndex.h"
+
+namespace NVL_Module
+{
+	class FrameReader
+	{
+	private:
+		VideoCapture _player;
+		int _position;
+		int _grabbed;
+		int _seekThreshold;
+		atomic<int> _seekCount;
+		FrameIndex * _index;
+	public:
+		FrameReader(const string& videoFile, int seekThreshold);
+
+		bool Read(int frame, Mat& image);
+
+		inline bool IsOpened() { return _player.isOpened(); }
+		inline double GetFrameCount() { return _index != nullptr ? _index->GetCount() : _player.get(CAP_PROP_FRAME_COUNT); }
+		inline double GetFps() { return _player.get(CAP_PROP_FPS); }
+		inline double GetTimestamp() { return _index != nullptr && _grabbed >= 0 ? _index->GetTimestamp(_grabbed) : _player.get(CAP_PROP_POS_MSEC); }
+		inline int GetSeekCount() { return _seekCount; }
+		inline void SetIndex(FrameIndex * index) { _index = index; }
+	private:
+		bool Advance(int frame);
+		bool Seek(int frame);
+		bool Grab();
+	};
+}
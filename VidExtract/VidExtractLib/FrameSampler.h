@@ -0,0 +1,49 @@
+//--------------------------------------------------
+// Base: Decides which frames of the video are sampled
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <climits>
+#include <iostream>
+using namespace std;
+
+namespace NVL_Module
+{
+	class FrameSampler
+	{
+	public:
+		virtual ~FrameSampler() = default;
+
+		/**
+		 * @brief Retrieve the frame of a sampling point
+		 * @param probe The number of the sampling point
+		 * @return int The frame (INT_MAX once the points run out)
+		 */
+		virtual int GetFrame(int probe) = 0;
+
+		/**
+		 * @brief Retrieve the first sampling point at or after a frame
+		 * @param frame The frame that we are starting from
+		 * @return int The number of the sampling point
+		 */
+		virtual int GetFirstProbe(int frame) = 0;
+
+		/**
+		 * @brief Retrieve the sampling point closest to a frame
+		 * @param frame The frame that we are looking for
+		 * @return int The number of the sampling point
+		 */
+		virtual int GetProbe(int frame) = 0;
+
+		/**
+		 * @brief Retrieve the smallest distance between two sampling points
+		 * @return int The distance in frames
+		 */
+		virtual int GetMinGap() = 0;
+	};
+}
@@ -0,0 +1,38 @@
+//--------------------------------------------------
+// Base: Decides which of the decoded frames are kept
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+namespace NVL_Module
+{
+	class FrameSelector
+	{
+	public:
+		virtual ~FrameSelector() = default;
+
+		/**
+		 * @brief Decide whether the given frame is kept (frames arrive in order)
+		 * @param image The decoded frame
+		 * @return true If the frame should be written
+		 * @return false If the frame should be dropped
+		 */
+		virtual bool Accept(Mat& image) = 0;
+
+		/**
+		 * @brief Indicates whether the decision depends on the frames that came before
+		 * @return true If the whole video has to be decoded by a single segment
+		 */
+		virtual bool IsSequential() { return false; }
+	};
+}
@@ -0,0 +1,40 @@
+//--------------------------------------------------
+// Base: The destination of the encoded frames
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include "FramePacket.h"
+
+namespace NVL_Module
+{
+	class FrameSink
+	{
+	public:
+		virtual ~FrameSink() = default;
+
+		/**
+		 * @brief Write an encoded frame (frames arrive in index order within each segment)
+		 * @param packet The packet that we are writing
+		 */
+		virtual void Write(FramePacket * packet) = 0;
+
+		/**
+		 * @brief Finish writing once all the frames have been delivered
+		 */
+		virtual void Close() {}
+
+		/**
+		 * @brief Indicate that the sink takes JPEG data (otherwise the decoded image is passed through as is)
+		 * @return true If the frames must be encoded
+		 */
+		virtual bool IsEncoded() { return true; }
+	};
+}
@@ -0,0 +1,62 @@
+//--------------------------------------------------
+// Sampler: Samples the frames of a sorted list (found from timestamps or given by the user)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include "FrameSampler.h"
+
+namespace NVL_Module
+{
+	class ListSampler : public FrameSampler
+	{
+	private:
+		vector<int> _frames;
+	public:
+		/**
+		 * @brief Main Constructor
+		 * @param frames The frames that are sampled (sorted and made unique here)
+		 */
+		ListSampler(vector<int>& frames) : _frames(frames)
+		{
+			sort(_frames.begin(), _frames.end());
+			_frames.erase(unique(_frames.begin(), _frames.end()), _frames.end());
+		}
+
+		virtual int GetFrame(int probe) override 
+		{
+			return probe >= 0 && probe < (int)_frames.size() ? _frames[probe] : INT_MAX;
+		}
+
+		virtual int GetFirstProbe(int frame) override 
+		{
+			return (int)(lower_bound(_frames.begin(), _frames.end(), frame) - _frames.begin());
+		}
+
+		virtual int GetProbe(int frame) override 
+		{
+			auto after = GetFirstProbe(frame);
+			if (after == 0) return 0;
+			if (after == (int)_frames.size()) return after - 1;
+			return frame - _frames[after - 1] <= _frames[after] - frame ? after - 1 : after;
+		}
+
+		virtual int GetMinGap() override 
+		{
+			auto result = INT_MAX;
+			for (auto i = 1; i < (int)_frames.size(); i++) result = min(result, _frames[i] - _frames[i - 1]);
+			return result;
+		}
+
+		inline vector<int>& GetFrames() { return _frames; }
+	};
+}
@@ -0,0 +1,41 @@
+//--------------------------------------------------
+// Model: A frame that the manifest records as written
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+namespace NVL_Module
+{
+	class ManifestEntry
+	{
+	private:
+		int _segment;
+		int _index;
+		int _frame;
+		string _name;
+		uint32_t _crc;
+		uint64_t _size;
+		uint64_t _offset;
+		double _timestamp;
+	public:
+		ManifestEntry(int segment, int index, int frame, const string& name, uint32_t crc, uint64_t size, uint64_t offset, double timestamp) :
+			_segment(segment), _index(index), _frame(frame), _name(name), _crc(crc), _size(size), _offset(offset), _timestamp(timestamp) {}
+
+		inline int& GetSegment() { return _segment; }
+		inline int& GetIndex() { return _index; }
+		inline int& GetFrame() { return _frame; }
+		inline string& GetName() { return _name; }
+		inline uint32_t& GetCrc() { return _crc; }
+		inline uint64_t& GetSize() { return _size; }
+		inline uint64_t& GetOffset() { return _offset; }
+		inline double& GetTimestamp() { return _timestamp; }
+	};
+}
@@ -0,0 +1,57 @@
+//--------------------------------------------------
+// Implementation of class ManifestSink
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ManifestSink.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param sink The sink that writes the frames (owned by this sink)
+ * @param manifest The manifest that the frames are recorded in
+ */
+ManifestSink::ManifestSink(FrameSink * sink, FrameManifest * manifest) : _sink(sink), _manifest(manifest)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Main Terminator
+ */
+ManifestSink::~ManifestSink()
+{
+	delete _sink;
+}
+
+//--------------------------------------------------
+// Write
+//--------------------------------------------------
+
+/**
+ * @brief Write the frame and then record it
+ * @param packet The packet that we are writing
+ * @remarks The frame is recorded only after the sink has flushed it, so a manifest line always
+ * refers to data that reached the file.
+ */
+void ManifestSink::Write(FramePacket * packet)
+{
+	_sink->Write(packet);
+	_manifest->Append(packet, FolderSink::GetFileName(packet->GetIndex()));
+}
+
+/**
+ * @brief Close the wrapped sink and mark the manifest as complete
+ */
+void ManifestSink::Close()
+{
+	_sink->Close();
+	_manifest->MarkComplete();
+}
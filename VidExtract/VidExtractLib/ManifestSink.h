@@ -0,0 +1,32 @@
+//--------------------------------------------------
+// Sink: Records each frame in the manifest once the wrapped sink has written it
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include "FrameSink.h"
+#include "FolderSink.h"
+#include "FrameManifest.h"
+
+namespace NVL_Module
+{
+	class ManifestSink : public FrameSink
+	{
+	private:
+		FrameSink * _sink;
+		FrameManifest * _manifest;
+	public:
+		ManifestSink(FrameSink * sink, FrameManifest * manifest);
+		~ManifestSink();
+
+		virtual void Write(FramePacket * packet) override;
+		virtual void Close() override;
+	};
+}
@@ -9,6 +9,12 @@
 #include "Module.h"
 using namespace NVL_Module;
 
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define SCORE_WIDTH 480
+
 //--------------------------------------------------
 // Constructor and Terminator
 //--------------------------------------------------
@@ -43,11 +49,65 @@ void Module::Initialize(NVLib::Parameters& parameters)
     _frameStep = ReadInteger(parameters, "frame_step");
     _workingFolder = ReadString(parameters, "working_folder");
     _uniqueName = ReadString(parameters, "unique_name");
+    _seekMode = ReadString(parameters, "seek_mode");
+    _gopSize = ReadInteger(parameters, "gop_size");
+    _quality = ReadInteger(parameters, "quality");
+    _threads = ReadInteger(parameters, "threads");
+    _queueSize = ReadInteger(parameters, "queue_size");
+    _segmentCount = ReadInteger(parameters, "segments");
+    _output = ReadString(parameters, "output");
+    _selection = ReadString(parameters, "selection");
+    _minParallax = NVLib::StringUtils::String2Double(ReadString(parameters, "min_parallax"));
+    _sharpness = ReadString(parameters, "sharpness");
+    _minSharpness = NVLib::StringUtils::String2Double(ReadString(parameters, "min_sharpness"));
+    _sharpWindow = ReadInteger(parameters, "sharp_window");
+    _threadBudget = ReadInteger(parameters, "thread_budget");
+    _ioSlots = ReadInteger(parameters, "io_slots");
+    _calibration = ReadString(parameters, "calibration");
+    _focal = NVLib::StringUtils::String2Double(ReadString(parameters, "focal"));
+    _cropRatio = NVLib::StringUtils::String2Double(ReadString(parameters, "crop_ratio"));
+    _resizeWidth = ReadInteger(parameters, "resize_width");
+    _resume = ReadBoolean(parameters, "resume");
+    _reportInterval = NVLib::StringUtils::String2Double(ReadString(parameters, "report_interval"));
+    _streamTarget = ReadString(parameters, "stream_target");
+    _streamFormat = ReadString(parameters, "stream_format");
+    _sampling = ReadString(parameters, "sampling");
+    _intervalMs = NVLib::StringUtils::String2Double(ReadString(parameters, "interval_ms"));
+    _frameList = ReadString(parameters, "frame_list");
+    _frameIndex = ReadBoolean(parameters, "frame_index");
 
     Log() << "input [video_file]: " << _videoFile << LoggerBase::End();
     Log() << "input [frame_step]: " << _frameStep << LoggerBase::End();
     Log() << "input [working_folder]: " << _workingFolder << LoggerBase::End();
     Log() << "input [uniqueName]: " << _uniqueName << LoggerBase::End(); 
+    Log() << "input [seek_mode]: " << _seekMode << LoggerBase::End();
+    Log() << "input [gop_size]: " << _gopSize << LoggerBase::End();
+    Log() << "input [quality]: " << _quality << LoggerBase::End();
+    Log() << "input [threads]: " << _threads << LoggerBase::End();
+    Log() << "input [queue_size]: " << _queueSize << LoggerBase::End();
+    Log() << "input [segments]: " << _segmentCount << LoggerBase::End();
+    Log() << "input [output]: " << _output << LoggerBase::End();
+    Log() << "input [selection]: " << _selection << LoggerBase::End();
+    Log() << "input [min_parallax]: " << _minParallax << LoggerBase::End();
+    Log() << "input [sharpness]: " << _sharpness << LoggerBase::End();
+    Log() << "input [min_sharpness]: " << _minSharpness << LoggerBase::End();
+    Log() << "input [sharp_window]: " << _sharpWindow << LoggerBase::End();
+    Log() << "input [thread_budget]: " << _threadBudget << LoggerBase::End();
+    Log() << "input [io_slots]: " << _ioSlots << LoggerBase::End();
+    Log() << "input [calibration]: " << _calibration << LoggerBase::End();
+    Log() << "input [focal]: " << _focal << LoggerBase::End();
+    Log() << "input [crop_ratio]: " << _cropRatio << LoggerBase::End();
+    Log() << "input [resize_width]: " << _resizeWidth << LoggerBase::End();
+    Log() << "input [resume]: " << _resume << LoggerBase::End();
+    Log() << "input [report_interval]: " << _reportInterval << LoggerBase::End();
+    Log() << "input [stream_target]: " << _streamTarget << LoggerBase::End();
+    Log() << "input [stream_format]: " << _streamFormat << LoggerBase::End();
+    Log() << "input [sampling]: " << _sampling << LoggerBase::End();
+    Log() << "input [interval_ms]: " << _intervalMs << LoggerBase::End();
+    Log() << "input [frame_list]: " << _frameList << LoggerBase::End();
+    Log() << "input [frame_index]: " << _frameIndex << LoggerBase::End();
+
+    ResourceBudget::GetInstance().Configure(_threadBudget, _ioSlots);
 }
 
 //--------------------------------------------------
@@ -60,57 +120,358 @@ void Module::Initialize(NVLib::Parameters& parameters)
  */
 int Module::Execute() 
 {
-    Log() << "Creating a temp folder" << LoggerBase::End();
-    auto tempPath = NVLib::FileUtils::PathCombine(_workingFolder, _uniqueName);
-    if (NVLib::FileUtils::Exists(tempPath)) NVLib::FileUtils::RemoveAll(tempPath);
-    NVLib::FileUtils::AddFolders(tempPath);
-
     Log() << "Creating a video player" << LoggerBase::End();
-    auto player = VideoCapture(_videoFile); 
+    auto player = new FrameReader(_videoFile, GetSeekThreshold()); 
     
-    if (!player.isOpened()) 
+    if (!player->IsOpened()) 
     {
         Log() << "Unable to open: " << _videoFile << LoggerBase::End();
-        return 1;
+        delete player; return 1;
     }
 
+    Log() << "Indexing the video" << LoggerBase::End();
+    auto index = LoadIndex(); player->SetIndex(index);
+
     Log() << "Find estimation of the frame position" << LoggerBase::End();
-    auto frameCount = player.get(CAP_PROP_FRAME_COUNT);
+    auto frameCount = player->GetFrameCount();
+    auto sampler = CreateSampler(index);
     Log() << "Full frame count: " << frameCount << LoggerBase::End();
-    Log() << "Estimated frame count: " << (frameCount / _frameStep) << LoggerBase::End();
-
-    auto index = 0;    
-    
-    while(true) 
-    {
-        Log() << "Processing Frame: " << index << LoggerBase::End();
+    Log() << "Estimated frame count: " << sampler->GetFirstProbe((int)frameCount) << LoggerBase::End();
 
-        auto position = index * _frameStep;
+    Log() << "Creating the frame selection" << LoggerBase::End();
+    auto selectors = vector<FrameSelector *>(); CreateSelectors(selectors);
 
-        player.set(CAP_PROP_POS_FRAMES, position);
+    Log() << "Checking for an earlier run" << LoggerBase::End();
+    auto recorded = _output != "stream";
+    auto manifest = FrameManifest(GetOutputPath() + ".manifest", GetSettings());
+    auto resume = _resume && recorded && manifest.Load();
 
-        Mat image; player >> image;
-        if (image.empty()) break;
+    if (resume && manifest.IsComplete() && NVLib::FileUtils::Exists(GetOutputPath() + GetOutputExtension())) 
+    {
+        Log() << "The output is already complete: " << manifest.GetEntries().size() << " frames" << LoggerBase::End();
+        for (auto selector : selectors) delete selector;
+        delete player; delete sampler; delete index; return EXIT_SUCCESS;
+    }
 
-        auto fileName = stringstream(); fileName << "image_" << setw(4) << setfill('0') << index << ".jpg";
-        auto path = NVLib::FileUtils::PathCombine(tempPath, fileName.str());
+    Log() << "Splitting the video into segments" << LoggerBase::End();
+    auto ranges = resume ? manifest.GetRanges() : vector<Vec2i>(); 
+    if (!resume) PlanSegments(frameCount, index, selectors, ranges);
+    auto segments = vector<Segment *>(); CreateSegments(player, index, sampler, ranges, segments);
 
-        imwrite(path, image);
+    Log() << "Creating the frame correction" << LoggerBase::End();
+    auto corrector = CreateCorrector();
 
-        index++;
-    }
+    Log() << "Creating the output" << LoggerBase::End();
+    auto entries = resume ? manifest.GetEntries() : vector<ManifestEntry>();
+    auto sink = CreateSink(resume, entries);
+    ResumeSegments(sampler, segments, entries);
+    if (recorded) { manifest.Start(ranges, entries); sink = new ManifestSink(sink, &manifest); }
+    if (resume) Log() << "Frames kept from the earlier run: " << entries.size() << LoggerBase::End();
+    for (auto segment : segments) Log() << "Segment " << segment->GetId() << ": " << segment->GetFirstFrame() << " to " << segment->GetEndFrame() << LoggerBase::End();
 
-    Log() << "Create the ZIP file" << LoggerBase::End();
-    auto outfile = stringstream(); outfile << _uniqueName << ".zip";
-    auto outPath = NVLib::FileUtils::PathCombine(_workingFolder, outfile.str());
-    NVLib::FileUtils::RemoveAll(outPath); 
-    NVLib::ZipUtils::Zip(outPath, tempPath);
+    Log() << "Extracting frames with " << GetEncoderCount() << " encoder threads" << LoggerBase::End();
+    auto pipeline = Pipeline(segments, sink, selectors, sampler, _quality, GetEncoderCount(), _queueSize);
+    pipeline.SetWindow(GetSharpWindow(sampler), SCORE_WIDTH);
+    pipeline.SetCorrector(corrector);
+    pipeline.SetReporter([this](const string& line) { Log() << "METRICS " << line << LoggerBase::End(); }, _reportInterval, frameCount);
+    auto count = pipeline.Run();
+    Log() << "Frames extracted: " << count << LoggerBase::End();
 
-    Log() << "Removing the temp folder" << LoggerBase::End();
-    NVLib::FileUtils::RemoveAll(tempPath);
+    auto summary = pipeline.GetSummary();
+    Log() << "SUMMARY " << summary << LoggerBase::End();
+    WriteSummary(summary);
+    for (auto segment : segments) delete segment;
+    for (auto selector : selectors) delete selector;
+    delete sink;
+    delete corrector;
+    delete sampler;
+    delete index;
 
     Log() << "Process Complete!" << LoggerBase::End();
 
     // Return the success code
     return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Determine the largest gap that the reader should cover by decoding forward
+ * @return int The gap in frames
+ * @remarks In "auto" mode we only seek once the step is much larger than the GOP, since a seek
+ * re-decodes from the previous keyframe anyway. In "grab" mode a segment still seeks to its first frame.
+ */
+int Module::GetSeekThreshold() 
+{
+    if (_seekMode == "grab") return INT_MAX;
+    else if (_seekMode == "seek") return 0;
+    else if (_seekMode == "auto") return 2 * _gopSize;
+    else throw runtime_error("Unknown seek mode: " + _seekMode);
+}
+
+/**
+ * @brief Determine the number of encoder threads to use
+ * @return int The number of threads (all but one core when the setting is zero)
+ */
+int Module::GetEncoderCount() 
+{
+    if (_threads > 0) return _threads;
+    return max(1, (int)thread::hardware_concurrency() - 1);
+}
+
+/**
+ * @brief Create the sink that the extracted frames are written to
+ * @param resume Continue the output that an earlier run left unfinished
+ * @param entries The frames that the earlier run wrote (trimmed to those that are still intact)
+ * @return FrameSink * The resultant sink
+ * @remarks The "zip" output streams the frames straight into <unique_name>.zip, the "pack" output into a
+ * single indexed container <unique_name>.vxp, the "folder" output leaves them as files in
+ * <working_folder>/<unique_name>, while the "stream" output sends them to stdout or a named pipe.
+ */
+FrameSink * Module::CreateSink(bool resume, vector<ManifestEntry>& entries) 
+{
+    if (_output == "stream") 
+    {
+        if (_streamFormat != "jpeg" && _streamFormat != "raw") throw runtime_error("Unknown stream format: " + _streamFormat);
+        return new StreamSink(_streamTarget, _streamFormat == "raw" ? STREAM_FORMAT_RAW : STREAM_FORMAT_JPEG);
+    }
+
+    auto path = GetOutputPath() + GetOutputExtension();
+
+    if (_output == "zip") return resume ? new ArchiveSink(path, entries) : new ArchiveSink(path);
+    else if (_output == "pack") return resume ? new PackSink(path, entries) : new PackSink(path);
+    else
+    {
+        if (!resume && NVLib::FileUtils::Exists(path)) NVLib::FileUtils::RemoveAll(path);
+        NVLib::FileUtils::AddFolders(path);
+        return resume ? new FolderSink(path, entries) : new FolderSink(path);
+    }
+}
+
+/**
+ * @brief Retrieve the path of the output without its extension
+ * @return string The resultant path
+ */
+string Module::GetOutputPath() 
+{
+    return NVLib::FileUtils::PathCombine(_workingFolder, _uniqueName);
+}
+
+/**
+ * @brief Retrieve the extension of the output file (empty for a folder)
+ * @return string The resultant extension
+ */
+string Module::GetOutputExtension() 
+{
+    if (_output == "zip") return ".zip";
+    else if (_output == "pack") return ".vxp";
+    else if (_output == "folder") return string();
+    else throw runtime_error("Unknown output: " + _output);
+}
+
+/**
+ * @brief Write the throughput summary next to the output as <unique_name>_metrics.json
+ * @param summary The summary (a JSON object)
+ */
+void Module::WriteSummary(const string& summary) 
+{
+    auto path = GetOutputPath() + "_metrics.json";
+    auto writer = ofstream(path);
+    if (!writer.is_open()) throw runtime_error("Unable to open: " + path);
+    writer << summary << endl;
+    writer.close();
+}
+
+/**
+ * @brief Describe the settings that change the output, so that a run only resumes from a matching one
+ * @return string The settings on a single line
+ */
+string Module::GetSettings() 
+{
+    auto error = error_code(); auto videoSize = filesystem::file_size(_videoFile, error);
+
+    auto settings = stringstream();
+    settings << "video=" << _videoFile << ";video_size=" << (error ? 0 : videoSize) << ";frame_step=" << _frameStep << ";seek_mode=" << _seekMode;
+    settings << ";quality=" << _quality << ";output=" << _output << ";selection=" << _selection << ";min_parallax=" << _minParallax;
+    settings << ";sharpness=" << _sharpness << ";min_sharpness=" << _minSharpness << ";sharp_window=" << (_sharpness == "window" ? _sharpWindow : 0);
+    settings << ";calibration=" << _calibration << ";focal=" << _focal << ";crop_ratio=" << _cropRatio << ";resize_width=" << _resizeWidth;
+    settings << ";sampling=" << _sampling;
+    if (_sampling == "interval") settings << ";interval_ms=" << _intervalMs;
+    if (_sampling == "list") settings << ";frame_list=" << _frameList;
+    return settings.str();
+}
+
+/**
+ * @brief Create the selectors that decide which frames are kept
+ * @param selectors The resultant selectors (empty when every step frame is kept)
+ * @remarks Blurred frames are rejected before the parallax is measured, and with "parallax" selection
+ * the frame step becomes the probe interval.
+ */
+void Module::CreateSelectors(vector<FrameSelector *>& selectors) 
+{
+    if (_sharpness == "reject") selectors.push_back(new SharpnessSelector(_minSharpness, SCORE_WIDTH));
+    else if (_sharpness != "none" && _sharpness != "window") throw runtime_error("Unknown sharpness mode: " + _sharpness);
+
+    if (_selection == "parallax") selectors.push_back(new ParallaxSelector(_minParallax, 320));
+    else if (_selection != "step") throw runtime_error("Unknown selection: " + _selection);
+}
+
+/**
+ * @brief Determine the window that the sharpest frame is picked from
+ * @param sampler Decides which frames are sampled
+ * @return int The number of frames either side of the sampling point (kept below half the smallest gap so windows do not overlap)
+ */
+int Module::GetSharpWindow(FrameSampler * sampler) 
+{
+    if (_sharpness != "window") return 0;
+    return max(0, min(_sharpWindow, (sampler->GetMinGap() - 1) / 2));
+}
+
+/**
+ * @brief Load the packet index of the video (building it on the first run)
+ * @return FrameIndex * The resultant index (nullptr when it is not needed)
+ * @remarks The index is cached as <working_folder>/<video name>.vxindex, and is rebuilt once the video
+ * changes size or modification time. Timestamp and list sampling always need it, since they work in
+ * presentation order rather than on the frame estimates of the backend.
+ */
+FrameIndex * Module::LoadIndex() 
+{
+    if (!_frameIndex && _sampling == "step") return nullptr;
+
+    auto cachePath = NVLib::FileUtils::PathCombine(_workingFolder, filesystem::path(_videoFile).filename().string() + ".vxindex");
+    auto index = FrameIndex::Load(_videoFile, cachePath);
+    if (index != nullptr) 
+    {
+        Log() << "Loaded the frame index: " << cachePath << LoggerBase::End();
+        return index;
+    }
+
+    index = new FrameIndex(_videoFile);
+    if (index->GetCount() == 0) { delete index; throw runtime_error("Unable to index: " + _videoFile); }
+    index->Save(_videoFile, cachePath);
+    Log() << "Indexed " << index->GetCount() << " frames (average keyframe interval " << index->GetAverageGop() << ")" << LoggerBase::End();
+
+    return index;
+}
+
+/**
+ * @brief Create the sampler that decides which frames are extracted
+ * @param index The packet index of the video (nullptr for step sampling without an index)
+ * @return FrameSampler * The resultant sampler
+ * @remarks "interval" samples the frame closest to every interval_ms from the first timestamp, while "list"
+ * samples the frame numbers (in presentation order) that are read from frame_list.
+ */
+FrameSampler * Module::CreateSampler(FrameIndex * index) 
+{
+    if (_sampling == "step") return new StepSampler(_frameStep);
+
+    auto frames = vector<int>();
+
+    if (_sampling == "interval") 
+    {
+        if (_intervalMs <= 0) throw runtime_error("The sampling interval must be positive");
+        auto last = index->GetTimestamp(index->GetCount() - 1);
+        for (auto timestamp = index->GetTimestamp(0); timestamp <= last; timestamp += _intervalMs) frames.push_back(index->FindNearest(timestamp));
+    }
+    else if (_sampling == "list") ReadFrameList(frames);
+    else throw runtime_error("Unknown sampling: " + _sampling);
+
+    auto sampler = new ListSampler(frames);
+    Log() << "Sampled frames: " << sampler->GetFrames().size() << LoggerBase::End();
+    return sampler;
+}
+
+/**
+ * @brief Read the frame numbers that are sampled from the frame list file
+ * @param frames The resultant frame numbers
+ */
+void Module::ReadFrameList(vector<int>& frames) 
+{
+    auto reader = ifstream(_frameList);
+    if (!reader.is_open()) throw runtime_error("Unable to open: " + _frameList);
+
+    auto frame = 0;
+    while (reader >> frame) if (frame >= 0) frames.push_back(frame);
+    if (!reader.eof()) throw runtime_error("Invalid frame number in: " + _frameList);
+
+    reader.close();
+}
+
+/**
+ * @brief Create the corrector that undistorts, crops and resizes the frames before they are encoded
+ * @return FrameCorrector * The resultant corrector (nullptr when no calibration was given)
+ * @remarks The calibration of the corrected frames is written to <unique_name>_calibration.xml, so the
+ * later stages see the same camera that FixPhoto would have produced.
+ */
+FrameCorrector * Module::CreateCorrector() 
+{
+    if (_calibration == string()) return nullptr;
+
+    auto corrector = new FrameCorrector(new Calibration(_calibration), _focal, _cropRatio, _resizeWidth);
+    auto size = corrector->GetOutput()->GetImageSize();
+    Log() << "Corrected frame size: " << size.width << " x " << size.height << LoggerBase::End();
+
+    auto outfile = stringstream(); outfile << _uniqueName << "_calibration.xml";
+    corrector->GetOutput()->Save(NVLib::FileUtils::PathCombine(_workingFolder, outfile.str()));
+
+    return corrector;
+}
+
+/**
+ * @brief Split the video into the ranges that are decoded in parallel
+ * @param frameCount The estimated number of frames in the video
+ * @param index The packet index whose keyframes the boundaries are placed on (nullptr to use the GOP size)
+ * @param selectors The selectors that are applied to the decoded frames
+ * @param ranges The resultant [first, end) frame ranges
+ * @remarks A stream is consumed as it arrives, so it is decoded as one segment to keep the frames in order
+ * (the encoding is still spread over the pool). A sequential selector (sharpness rejection) also needs one
+ * segment, since the frames it drops shift the names of the frames that follow. The sharpness window keeps the
+ * segments, as it writes exactly one frame per sampling point whichever candidate it picks.
+ */
+void Module::PlanSegments(double frameCount, FrameIndex * index, vector<FrameSelector *>& selectors, vector<Vec2i>& ranges) 
+{
+    auto count = _segmentCount > 0 ? _segmentCount : max(1, (int)thread::hardware_concurrency() / 2);
+    for (auto selector : selectors) if (selector->IsSequential()) count = 1;
+    if (_output == "stream") count = 1;
+
+    auto gopSize = index != nullptr ? index->GetAverageGop() : _gopSize;
+    Segment::Plan(frameCount, _sampling == "step" ? _frameStep : 1, gopSize, index, count, ranges);
+}
+
+/**
+ * @brief Create a reader for each segment of the video
+ * @param player The reader that was already opened (it is used by the first segment)
+ * @param index The packet index that the readers share (nullptr for none)
+ * @param sampler Decides which frames are sampled (used to number the output of each segment)
+ * @param ranges The [first, end) frame ranges of the segments
+ * @param segments The segments that were created
+ */
+void Module::CreateSegments(FrameReader * player, FrameIndex * index, FrameSampler * sampler, vector<Vec2i>& ranges, vector<Segment *>& segments) 
+{
+    for (auto i = 0; i < (int)ranges.size(); i++) 
+    {
+        auto reader = i == 0 ? player : new FrameReader(_videoFile, GetSeekThreshold());
+        reader->SetIndex(index);
+        segments.push_back(new Segment(i, reader, ranges[i][0], ranges[i][1], sampler->GetFirstProbe(ranges[i][0])));
+    }
+}
+
+/**
+ * @brief Move each segment past the frames that an earlier run already wrote
+ * @param sampler Decides which frames are sampled
+ * @param segments The segments of the video
+ * @param entries The frames that were kept (in write order, so each segment's frames are a prefix of its range)
+ * @remarks The next probe comes after the one that produced the last written frame (a sharp-window frame lies
+ * within half the sampling gap of its probe), so the reader seeks straight to the first missing frame.
+ */
+void Module::ResumeSegments(FrameSampler * sampler, vector<Segment *>& segments, vector<ManifestEntry>& entries) 
+{
+    for (auto& entry : entries) 
+    {
+        auto segment = segments[entry.GetSegment()];
+        segment->GetNextIndex()++;
+        segment->GetFirstFrame() = sampler->GetFrame(sampler->GetProbe(entry.GetFrame()) + 1);
+    }
+}
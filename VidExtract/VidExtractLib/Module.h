@@ -6,6 +6,7 @@
 // @date: 2022-03-24
 //--------------------------------------------------
 
+#include <filesystem>
 #include <iostream>
 using namespace std;
 
@@ -16,7 +17,19 @@ using namespace cv;
 
 #include <NVLib/StringUtils.h>
 #include <NVLib/FileUtils.h>
-#include <NVLib/ZipUtils.h>
+
+#include "FrameReader.h"
+#include "FolderSink.h"
+#include "ArchiveSink.h"
+#include "PackSink.h"
+#include "ManifestSink.h"
+#include "StreamSink.h"
+#include "Pipeline.h"
+#include "StepSampler.h"
+#include "ListSampler.h"
+#include "FrameCorrector.h"
+#include "ParallaxSelector.h"
+#include "SharpnessSelector.h"
 
 namespace NVL_Module 
 {
@@ -32,6 +45,32 @@ class Module : public NVL_Module::ModuleBase
         int _frameStep;
         string _workingFolder;
         string _uniqueName;
+        string _seekMode;
+        int _gopSize;
+        int _quality;
+        int _threads;
+        int _queueSize;
+        int _segmentCount;
+        string _output;
+        string _selection;
+        double _minParallax;
+        string _sharpness;
+        double _minSharpness;
+        int _sharpWindow;
+        int _threadBudget;
+        int _ioSlots;
+        string _calibration;
+        double _focal;
+        double _cropRatio;
+        int _resizeWidth;
+        bool _resume;
+        double _reportInterval;
+        string _streamTarget;
+        string _streamFormat;
+        string _sampling;
+        double _intervalMs;
+        string _frameList;
+        bool _frameIndex;
     public:
         Module(); 
         ~Module();
@@ -39,6 +78,23 @@ class Module : public NVL_Module::ModuleBase
         virtual string GetModuleName() override { return "VidExtract"; }
         virtual void Initialize(NVLib::Parameters& parameters) override;
         virtual int Execute() override;
+    private:
+        int GetSeekThreshold();
+        int GetEncoderCount();
+        FrameSink * CreateSink(bool resume, vector<ManifestEntry>& entries);
+        string GetOutputPath();
+        string GetOutputExtension();
+        string GetSettings();
+        void WriteSummary(const string& summary);
+        void CreateSelectors(vector<FrameSelector *>& selectors);
+        int GetSharpWindow(FrameSampler * sampler);
+        FrameIndex * LoadIndex();
+        FrameSampler * CreateSampler(FrameIndex * index);
+        void ReadFrameList(vector<int>& frames);
+        FrameCorrector * CreateCorrector();
+        void PlanSegments(double frameCount, FrameIndex * index, vector<FrameSelector *>& selectors, vector<Vec2i>& ranges);
+        void CreateSegments(FrameReader * player, FrameIndex * index, FrameSampler * sampler, vector<Vec2i>& ranges, vector<Segment *>& segments);
+        void ResumeSegments(FrameSampler * sampler, vector<Segment *>& segments, vector<ManifestEntry>& entries);
     };
 }
 
@@ -0,0 +1,51 @@
+//--------------------------------------------------
+// Model: An index record of the packed frame container
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+//--------------------------------------------------
+// Layout
+//--------------------------------------------------
+//
+// Header (32 bytes): magic "VXPK", version (u32), frame count (u64), index offset (u64), reserved (u64)
+// Frames: the encoded frames, one after the other
+// Index (32 bytes per frame, sorted by index): offset (u64), size (u64), index (u32), frame (u32), timestamp in ms (f64)
+//
+// All values are little-endian. The index follows the frames so the container can be streamed, and the
+// header is patched on close to point at it.
+
+#define PACK_MAGIC 0x4B505856u
+#define PACK_VERSION 1
+#define PACK_HEADER_SIZE 32
+#define PACK_ENTRY_SIZE 32
+
+namespace NVL_Module
+{
+	class PackEntry
+	{
+	private:
+		uint64_t _offset;
+		uint64_t _size;
+		uint32_t _index;
+		uint32_t _frame;
+		double _timestamp;
+	public:
+		PackEntry() : _offset(0), _size(0), _index(0), _frame(0), _timestamp(0) {}
+		PackEntry(uint64_t offset, uint64_t size, uint32_t index, uint32_t frame, double timestamp) : _offset(offset), _size(size), _index(index), _frame(frame), _timestamp(timestamp) {}
+
+		inline uint64_t& GetOffset() { return _offset; }
+		inline uint64_t& GetSize() { return _size; }
+		inline uint32_t& GetIndex() { return _index; }
+		inline uint32_t& GetFrame() { return _frame; }
+		inline double& GetTimestamp() { return _timestamp; }
+	};
+}
@@ -0,0 +1,124 @@
+//--------------------------------------------------
+// Implementation of class PackReader
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "PackReader.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the container that we are reading
+ * @remarks Only the header is validated here; frames are not touched until they are requested, so
+ * opening a container is O(1) and the pages of a frame are read in by the OS on first access.
+ */
+PackReader::PackReader(const string& path) : _path(path), _file(-1), _data(nullptr), _size(0), _count(0), _indexOffset(0)
+{
+	_file = open(path.c_str(), O_RDONLY);
+	if (_file < 0) throw runtime_error("Unable to open: " + path);
+
+	struct stat info; 
+	if (fstat(_file, &info) != 0 || info.st_size < PACK_HEADER_SIZE) { close(_file); throw runtime_error("Not a frame container: " + path); }
+	_size = (size_t)info.st_size;
+
+	auto data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _file, 0);
+	if (data == MAP_FAILED) { close(_file); throw runtime_error("Unable to map: " + path); }
+	_data = (const unsigned char *) data;
+
+	_count = Read64(8); _indexOffset = Read64(16);
+
+	auto valid = Read32(0) == PACK_MAGIC && Read32(4) == PACK_VERSION;
+	valid = valid && _indexOffset >= PACK_HEADER_SIZE && _indexOffset <= _size && _count <= (_size - _indexOffset) / PACK_ENTRY_SIZE;
+	if (!valid) { munmap((void *) _data, _size); close(_file); throw runtime_error("Not a frame container (or it was not closed): " + path); }
+}
+
+/**
+ * @brief Main Terminator
+ */
+PackReader::~PackReader()
+{
+	munmap((void *) _data, _size);
+	close(_file);
+}
+
+//--------------------------------------------------
+// Access
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the index record of a frame
+ * @param position The position of the frame within the container
+ * @return PackEntry The resultant record
+ */
+PackEntry PackReader::GetEntry(size_t position)
+{
+	if (position >= _count) throw runtime_error("Frame position out of range: " + to_string(position));
+
+	auto offset = _indexOffset + position * PACK_ENTRY_SIZE;
+	auto timestampBits = Read64(offset + 24); double timestamp; memcpy(&timestamp, &timestampBits, sizeof(timestamp));
+	auto entry = PackEntry(Read64(offset), Read64(offset + 8), Read32(offset + 16), Read32(offset + 20), timestamp);
+
+	if (entry.GetOffset() < PACK_HEADER_SIZE || entry.GetOffset() > _indexOffset || entry.GetSize() > _indexOffset - entry.GetOffset()) 
+	{
+		throw runtime_error("Corrupt frame record in: " + _path);
+	}
+
+	return entry;
+}
+
+/**
+ * @brief Retrieve the encoded bytes of a frame (without copying them)
+ * @param position The position of the frame within the container
+ * @param size The number of bytes in the frame
+ * @return const unsigned char * The encoded frame (valid while the reader is alive)
+ */
+const unsigned char * PackReader::GetData(size_t position, size_t& size)
+{
+	auto entry = GetEntry(position);
+	size = (size_t)entry.GetSize();
+	return _data + entry.GetOffset();
+}
+
+/**
+ * @brief Decode a frame
+ * @param position The position of the frame within the container
+ * @return Mat The decoded frame
+ */
+Mat PackReader::GetImage(size_t position)
+{
+	size_t size; auto data = GetData(position, size);
+	auto buffer = Mat(1, (int)size, CV_8UC1, (void *) data);
+	return imdecode(buffer, IMREAD_COLOR);
+}
+
+//--------------------------------------------------
+// Little-endian Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Read a 32-bit value
+ * @param offset The offset of the value
+ * @return uint32_t The resultant value
+ */
+uint32_t PackReader::Read32(uint64_t offset)
+{
+	auto bytes = _data + offset;
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+/**
+ * @brief Read a 64-bit value
+ * @param offset The offset of the value
+ * @return uint64_t The resultant value
+ */
+uint64_t PackReader::Read64(uint64_t offset)
+{
+	return (uint64_t)Read32(offset) | ((uint64_t)Read32(offset + 4) << 32);
+}
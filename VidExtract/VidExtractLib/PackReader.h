@@ -0,0 +1,49 @@
+//--------------------------------------------------
+// Utility: Memory-maps a packed frame container for random access
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "PackEntry.h"
+
+namespace NVL_Module
+{
+	class PackReader
+	{
+	private:
+		string _path;
+		int _file;
+		const unsigned char * _data;
+		size_t _size;
+		uint64_t _count;
+		uint64_t _indexOffset;
+	public:
+		PackReader(const string& path);
+		~PackReader();
+
+		PackEntry GetEntry(size_t position);
+		const unsigned char * GetData(size_t position, size_t& size);
+		Mat GetImage(size_t position);
+
+		inline size_t GetCount() { return (size_t)_count; }
+	private:
+		uint32_t Read32(uint64_t offset);
+		uint64_t Read64(uint64_t offset);
+	};
+}
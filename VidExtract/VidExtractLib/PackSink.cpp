@@ -0,0 +1,86 @@
+//--------------------------------------------------
+// Implementation of class PackSink
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "PackSink.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the container that we are writing
+ */
+PackSink::PackSink(const string& path) : _writer(path)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Resume Constructor
+ * @param path The path to the container that an earlier run left unfinished
+ * @param entries The frames that the manifest records (trimmed to those that are still intact)
+ */
+PackSink::PackSink(const string& path, vector<ManifestEntry>& entries) : _writer(path, Keep(path, entries))
+{
+	// Extra implementation can go here
+}
+
+//--------------------------------------------------
+// Resume
+//--------------------------------------------------
+
+/**
+ * @brief Find the frames of an unfinished container that can be kept
+ * @param path The path to the container
+ * @param entries The frames that the manifest records (trimmed to those that are kept)
+ * @return vector<PackEntry> The kept frames
+ * @remarks Frames must follow each other and lie within the file; the checksum of the last one is confirmed.
+ */
+vector<PackEntry> PackSink::Keep(const string& path, vector<ManifestEntry>& entries)
+{
+	auto error = error_code(); auto fileSize = filesystem::file_size(path, error);
+	if (error) fileSize = 0;
+
+	auto result = vector<PackEntry>(); auto offset = (uint64_t)PACK_HEADER_SIZE;
+	for (auto& entry : entries)
+	{
+		if (entry.GetOffset() != offset || offset + entry.GetSize() > fileSize) break;
+		result.push_back(PackEntry(offset, entry.GetSize(), (uint32_t)entry.GetIndex(), (uint32_t)entry.GetFrame(), entry.GetTimestamp()));
+		offset += entry.GetSize();
+	}
+
+	if (!result.empty() && !FrameManifest::CheckData(path, result.back().GetOffset(), result.back().GetSize(), entries[result.size() - 1].GetCrc())) result.pop_back();
+
+	entries.erase(entries.begin() + result.size(), entries.end());
+	return result;
+}
+
+//--------------------------------------------------
+// Write
+//--------------------------------------------------
+
+/**
+ * @brief Append the encoded frame to the container
+ * @param packet The packet that we are writing
+ */
+void PackSink::Write(FramePacket * packet)
+{
+	auto& buffer = packet->GetBuffer();
+	packet->GetOffset() = _writer.Add(packet->GetIndex(), packet->GetFrame(), packet->GetTimestamp(), buffer.data(), buffer.size());
+	_writer.Flush();
+}
+
+/**
+ * @brief Write the index of the container
+ */
+void PackSink::Close()
+{
+	_writer.Close();
+}
@@ -0,0 +1,33 @@
+//--------------------------------------------------
+// Sink: Streams each encoded frame into a single packed container file
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include "FrameSink.h"
+#include "PackWriter.h"
+#include "FrameManifest.h"
+
+namespace NVL_Module
+{
+	class PackSink : public FrameSink
+	{
+	private:
+		PackWriter _writer;
+	public:
+		PackSink(const string& path);
+		PackSink(const string& path, vector<ManifestEntry>& entries);
+
+		virtual void Write(FramePacket * packet) override;
+		virtual void Close() override;
+	private:
+		static vector<PackEntry> Keep(const string& path, vector<ManifestEntry>& entries);
+	};
+}
@@ -0,0 +1,151 @@
+//--------------------------------------------------
+// Implementation of class PackWriter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "PackWriter.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the container that we are creating (it is replaced if it exists)
+ */
+PackWriter::PackWriter(const string& path) : _path(path), _offset(PACK_HEADER_SIZE)
+{
+	_writer.open(path, ios::binary | ios::trunc);
+	if (!_writer.is_open()) throw runtime_error("Unable to open: " + path);
+
+	WriteHeader(0, 0);
+}
+
+/**
+ * @brief Append Constructor
+ * @param path The path to a container that was left unfinished
+ * @param entries The frames at the start of the container that are kept (in file order)
+ * @remarks Anything after the kept frames is cut off, and the header is rewritten when the container is closed.
+ */
+PackWriter::PackWriter(const string& path, const vector<PackEntry>& entries) : _path(path), _entries(entries), _offset(PACK_HEADER_SIZE)
+{
+	if (!_entries.empty()) _offset = _entries.back().GetOffset() + _entries.back().GetSize();
+
+	if (!_entries.empty()) 
+	{
+		filesystem::resize_file(path, _offset);
+		_writer.open(path, ios::binary | ios::in | ios::out);
+		_writer.seekp(_offset);
+	}
+	else _writer.open(path, ios::binary | ios::trunc);
+
+	if (!_writer.is_open()) throw runtime_error("Unable to open: " + path);
+	if (_entries.empty()) WriteHeader(0, 0);
+}
+
+/**
+ * @brief Main Terminator
+ */
+PackWriter::~PackWriter()
+{
+	if (_writer.is_open()) _writer.close();
+}
+
+//--------------------------------------------------
+// Writing
+//--------------------------------------------------
+
+/**
+ * @brief Append an encoded frame to the container
+ * @param index The output index of the frame
+ * @param frame The source frame number
+ * @param timestamp The source timestamp (in milliseconds)
+ * @param data The encoded frame
+ * @param size The number of bytes in the encoded frame
+ * @return uint64_t The offset of the frame within the container
+ */
+uint64_t PackWriter::Add(int index, int frame, double timestamp, const unsigned char * data, size_t size)
+{
+	_entries.push_back(PackEntry(_offset, size, (uint32_t)index, (uint32_t)frame, timestamp));
+
+	_writer.write((const char *) data, size);
+	if (!_writer) throw runtime_error("Unable to write to: " + _path);
+
+	_offset += size;
+
+	return _entries.back().GetOffset();
+}
+
+/**
+ * @brief Write the index and point the header at it
+ * @remarks Segments deliver frames out of global order, so the index is sorted here to make
+ * record i describe output frame i.
+ */
+void PackWriter::Close()
+{
+	sort(_entries.begin(), _entries.end(), [](PackEntry& a, PackEntry& b) { return a.GetIndex() < b.GetIndex(); });
+
+	auto indexOffset = _offset;
+	for (auto& entry : _entries) WriteEntry(entry);
+
+	_writer.seekp(0);
+	WriteHeader(_entries.size(), indexOffset);
+
+	_writer.close();
+	if (_writer.fail()) throw runtime_error("Unable to finish writing: " + _path);
+}
+
+//--------------------------------------------------
+// Records
+//--------------------------------------------------
+
+/**
+ * @brief Write the container header
+ * @param count The number of frames in the container
+ * @param indexOffset The offset of the index
+ */
+void PackWriter::WriteHeader(uint64_t count, uint64_t indexOffset)
+{
+	Write32(PACK_MAGIC); Write32(PACK_VERSION);
+	Write64(count); Write64(indexOffset); Write64(0);
+}
+
+/**
+ * @brief Write the index record of a frame
+ * @param entry The entry that we are writing
+ */
+void PackWriter::WriteEntry(PackEntry& entry)
+{
+	uint64_t timestamp; memcpy(&timestamp, &entry.GetTimestamp(), sizeof(timestamp));
+
+	Write64(entry.GetOffset()); Write64(entry.GetSize());
+	Write32(entry.GetIndex()); Write32(entry.GetFrame());
+	Write64(timestamp);
+}
+
+//--------------------------------------------------
+// Little-endian Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Write a 32-bit value
+ * @param value The value that we are writing
+ */
+void PackWriter::Write32(uint32_t value)
+{
+	unsigned char bytes[4] = { (unsigned char)(value & 0xFF), (unsigned char)((value >> 8) & 0xFF), (unsigned char)((value >> 16) & 0xFF), (unsigned char)(value >> 24) };
+	_writer.write((const char *) bytes, 4);
+}
+
+/**
+ * @brief Write a 64-bit value
+ * @param value The value that we are writing
+ */
+void PackWriter::Write64(uint64_t value)
+{
+	Write32((uint32_t)(value & 0xFFFFFFFF)); Write32((uint32_t)(value >> 32));
+}
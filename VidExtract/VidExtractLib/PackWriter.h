@@ -0,0 +1,47 @@
+//--------------------------------------------------
+// Utility: Streams encoded frames into a single packed container file
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include "PackEntry.h"
+
+namespace NVL_Module
+{
+	class PackWriter
+	{
+	private:
+		string _path;
+		ofstream _writer;
+		vector<PackEntry> _entries;
+		uint64_t _offset;
+	public:
+		PackWriter(const string& path);
+		PackWriter(const string& path, const vector<PackEntry>& entries);
+		~PackWriter();
+
+		uint64_t Add(int index, int frame, double timestamp, const unsigned char * data, size_t size);
+		void Close();
+		void Flush() { _writer.flush(); }
+
+		inline vector<PackEntry>& GetEntries() { return _entries; }
+	private:
+		void WriteHeader(uint64_t count, uint64_t indexOffset);
+		void WriteEntry(PackEntry& entry);
+
+		void Write32(uint32_t value);
+		void Write64(uint64_t value);
+	};
+}
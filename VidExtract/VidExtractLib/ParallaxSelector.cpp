@@ -0,0 +1,111 @@
+//--------------------------------------------------
+// Implementation of class ParallaxSelector
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ParallaxSelector.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define PARALLAX_MAX_POINTS 200
+#define PARALLAX_MIN_POINTS 20
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param minParallax The median displacement (as a fraction of the image width) needed to keep a frame
+ * @param width The width of the gray image that the flow is tracked on
+ */
+ParallaxSelector::ParallaxSelector(double minParallax, int width) : _minParallax(minParallax), _width(width)
+{
+	// Extra implementation can go here
+}
+
+//--------------------------------------------------
+// Selection
+//--------------------------------------------------
+
+/**
+ * @brief Track the features from the last probe and keep the frame if they have moved far enough
+ * @param image The decoded frame
+ * @return true If the frame should be written
+ * @return false If the frame should be dropped
+ * @remarks Frames are also kept when the tracks are lost, since the scene has changed too much to measure.
+ */
+bool ParallaxSelector::Accept(Mat& image)
+{
+	Mat gray = GetGray(image);
+
+	if (_previous.empty()) { Reset(gray); return true; }
+
+	auto next = vector<Point2f>(); auto status = vector<uchar>(); auto error = vector<float>();
+	calcOpticalFlowPyrLK(_previous, gray, _points, next, status, error);
+
+	auto points = vector<Point2f>(); auto origins = vector<Point2f>();
+	for (auto i = 0; i < (int)status.size(); i++)
+	{
+		if (!status[i]) continue;
+		points.push_back(next[i]); origins.push_back(_origins[i]);
+	}
+	_points = points; _origins = origins;
+
+	if (_points.size() < PARALLAX_MIN_POINTS || GetMedianParallax() >= _minParallax * gray.cols) { Reset(gray); return true; }
+
+	_previous = gray;
+	return false;
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Convert the frame into a downsampled gray image
+ * @param image The decoded frame
+ * @return Mat The resultant gray image
+ */
+Mat ParallaxSelector::GetGray(Mat& image)
+{
+	auto factor = image.cols > _width ? (double)_width / image.cols : 1.0;
+	Mat small; resize(image, small, Size(), factor, factor, INTER_AREA);
+	Mat gray; cvtColor(small, gray, COLOR_BGR2GRAY);
+	return gray;
+}
+
+/**
+ * @brief Start tracking a fresh set of features from a kept frame
+ * @param gray The gray image of the kept frame
+ */
+void ParallaxSelector::Reset(Mat& gray)
+{
+	_points.clear(); goodFeaturesToTrack(gray, _points, PARALLAX_MAX_POINTS, 0.01, 8);
+	_origins = _points;
+	_previous = gray;
+}
+
+/**
+ * @brief Find the median displacement of the tracked features since the last kept frame
+ * @return double The median displacement in pixels
+ */
+double ParallaxSelector::GetMedianParallax()
+{
+	auto distances = vector<double>();
+	for (auto i = 0; i < (int)_points.size(); i++)
+	{
+		auto xDiff = _points[i].x - _origins[i].x; auto yDiff = _points[i].y - _origins[i].y;
+		distances.push_back(sqrt(xDiff * xDiff + yDiff * yDiff));
+	}
+
+	auto middle = distances.begin() + distances.size() / 2;
+	nth_element(distances.begin(), middle, distances.end());
+	return *middle;
+}
@@ -0,0 +1,39 @@
+//--------------------------------------------------
+// Selector: Keeps a frame once the scene has moved far enough since the last kept frame
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "FrameSelector.h"
+
+namespace NVL_Module
+{
+	class ParallaxSelector : public FrameSelector
+	{
+	private:
+		double _minParallax;
+		int _width;
+		Mat _previous;
+		vector<Point2f> _points;
+		vector<Point2f> _origins;
+	public:
+		ParallaxSelector(double minParallax, int width);
+
+		virtual bool Accept(Mat& image) override;
+		virtual bool IsSequential() override { return true; }
+	private:
+		Mat GetGray(Mat& image);
+		void Reset(Mat& gray);
+		double GetMedianParallax();
+	};
+}
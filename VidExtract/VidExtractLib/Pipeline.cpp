@@ -0,0 +1,319 @@
+//--------------------------------------------------
+// Implementation of class Pipeline
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "Pipeline.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param segments The segments that are decoded (each on its own thread)
+ * @param sink The sink that the encoded frames are written to
+ * @param selectors Decide which of the decoded frames are kept (all of them if this is empty)
+ * @param sampler Decides which frames are extracted (or probed, when there is a selector)
+ * @param quality The JPEG quality of the encoded frames
+ * @param encoderCount The number of encoder threads
+ * @param capacity The maximum number of frames waiting to be encoded (or written)
+ */
+Pipeline::Pipeline(vector<Segment *>& segments, FrameSink * sink, vector<FrameSelector *>& selectors, FrameSampler * sampler, int quality, int encoderCount, int capacity) :
+	_segments(segments), _sink(sink), _selectors(selectors), _sampler(sampler), _window(0), _scoreWidth(0), _corrector(nullptr), _quality(quality), _encoderCount(encoderCount), _capacity(capacity), _decoded(capacity), _written(0), _failed(false), _decoding(0), _interval(0), _reportDone(false)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Main Terminator
+ */
+Pipeline::~Pipeline()
+{
+	FramePacket * packet; _decoded.Close();
+	while (_decoded.Pop(packet)) delete packet;
+	for (auto& pending : _pending) delete pending.second;
+}
+
+//--------------------------------------------------
+// Execution
+//--------------------------------------------------
+
+/**
+ * @brief Run the pipeline until the reader is exhausted
+ * @return int The number of frames that were written
+ */
+int Pipeline::Run()
+{
+	_metrics.Start();
+	auto reporter = _reporter && _interval > 0 ? thread(&Pipeline::Report, this) : thread();
+
+	auto encoders = vector<thread>();
+	for (auto i = 0; i < _encoderCount; i++) encoders.push_back(thread(&Pipeline::Encode, this));
+	auto decoders = vector<thread>(); _decoding = (int)_segments.size();
+	for (auto segment : _segments) decoders.push_back(thread(&Pipeline::Decode, this, segment));
+
+	for (auto& decoder : decoders) decoder.join();
+	for (auto& encoder : encoders) encoder.join();
+
+	{
+		auto guard = lock_guard<mutex>(_reportLock); _reportDone = true;
+	}
+	_reportChanged.notify_all();
+	if (reporter.joinable()) reporter.join();
+
+	if (_error) rethrow_exception(_error);
+	_sink->Close();
+
+	return _written;
+}
+
+//--------------------------------------------------
+// Stages
+//--------------------------------------------------
+
+/**
+ * @brief Decode the selected frames of a segment into the queue (blocking while the encoders catch up)
+ * @param segment The segment that we are decoding
+ */
+void Pipeline::Decode(Segment * segment)
+{
+	try
+	{
+		auto index = segment->GetNextIndex();
+
+		for (auto probe = _sampler->GetFirstProbe(segment->GetFirstFrame()); !_failed; probe++)
+		{
+			auto frame = _sampler->GetFrame(probe); if (frame >= segment->GetEndFrame()) break;
+			Mat image; auto chosen = frame; auto timestamp = 0.0;
+			if (!Read(segment, frame, image, chosen, timestamp)) break;
+			_metrics.AddProbe();
+			if (!Accept(image)) continue;
+			_metrics.AddDecoded();
+
+			auto packet = new FramePacket(segment->GetId(), index++, chosen, image);
+			packet->GetTimestamp() = timestamp;
+			if (!_decoded.Push(packet)) { delete packet; break; }
+		}
+	}
+	catch (...)
+	{
+		Fail();
+	}
+
+	// The last decoder to finish closes the queue
+	if (--_decoding == 0) _decoded.Close();
+}
+
+/**
+ * @brief Encode frames from the queue and pass them on to be written
+ * @remarks Frames are corrected (when there is a corrector) here rather than on the decode threads, so
+ * the remap is spread over the encoder pool. The checksum is also found here, off the ordered write path.
+ */
+void Pipeline::Encode()
+{
+	auto parameters = vector<int> { IMWRITE_JPEG_QUALITY, _quality };
+
+	FramePacket * packet;
+	while (_decoded.Pop(packet))
+	{
+		try
+		{
+			if (_failed) { delete packet; continue; }
+
+			auto token = TokenGuard(ResourceBudget::GetInstance().GetCpu());
+			if (_corrector != nullptr) _corrector->Apply(packet->GetImage());
+			if (_sink->IsEncoded()) 
+			{
+				if (!imencode(".jpg", packet->GetImage(), packet->GetBuffer(), parameters)) throw runtime_error("Unable to encode frame");
+				packet->GetCrc() = ZipWriter::GetCrc32(packet->GetBuffer().data(), packet->GetBuffer().size());
+				packet->GetImage().release();
+			}
+			else if (!packet->GetImage().isContinuous()) packet->GetImage() = packet->GetImage().clone();
+			_metrics.AddEncoded();
+		}
+		catch (...)
+		{
+			delete packet; Fail(); continue;
+		}
+
+		Submit(packet);
+	}
+}
+
+/**
+ * @brief Hand an encoded frame to the sink, keeping the output of each segment in index order
+ * @param packet The packet that was encoded
+ * @remarks A packet waits while it is too far ahead of the next index to be written for its segment, so
+ * the number of encoded frames held in memory stays bounded by the capacity (per segment).
+ */
+void Pipeline::Submit(FramePacket * packet)
+{
+	auto segment = _segments[packet->GetSegment()];
+
+	auto guard = unique_lock<mutex>(_orderLock);
+	_orderChanged.wait(guard, [&] { return _failed || packet->GetIndex() - segment->GetNextIndex() < _capacity; });
+	if (_failed) { delete packet; return; }
+
+	_pending[make_pair(segment->GetId(), packet->GetIndex())] = packet;
+
+	try
+	{
+		for (auto next = _pending.find(make_pair(segment->GetId(), segment->GetNextIndex())); next != _pending.end(); next = _pending.find(make_pair(segment->GetId(), segment->GetNextIndex())))
+		{
+			auto ready = next->second; _pending.erase(next);
+			auto owner = unique_ptr<FramePacket>(ready);
+			auto token = TokenGuard(ResourceBudget::GetInstance().GetIo());
+			_sink->Write(ready);
+			segment->GetNextIndex()++; _written++;
+			_metrics.AddWritten(ready->GetByteCount());
+		}
+	}
+	catch (...)
+	{
+		guard.unlock(); Fail(); return;
+	}
+
+	_orderChanged.notify_all();
+}
+
+//--------------------------------------------------
+// Selection
+//--------------------------------------------------
+
+/**
+ * @brief Read the frame at a sampling point (or the sharpest frame within the window around it)
+ * @param segment The segment that we are reading from
+ * @param frame The sampling point
+ * @param image The image that was read
+ * @param chosen The frame that was chosen
+ * @param timestamp The source timestamp (ms) of the chosen frame
+ * @return true If a frame was read
+ * @return false If the end of the video was reached before the sampling point
+ */
+bool Pipeline::Read(Segment * segment, int frame, Mat& image, int& chosen, double& timestamp)
+{
+	auto reader = segment->GetReader(); chosen = frame;
+	if (_window <= 0) 
+	{
+		if (!reader->Read(frame, image)) return false;
+		timestamp = reader->GetTimestamp(); return true;
+	}
+
+	auto bestScore = -1.0;
+	for (auto candidateFrame = max(0, frame - _window); candidateFrame <= frame + _window; candidateFrame++)
+	{
+		Mat candidate; 
+		if (!reader->Read(candidateFrame, candidate)) 
+		{
+			if (candidateFrame <= frame) return false;
+			break;
+		}
+
+		auto score = SharpnessScorer::GetScore(candidate, _scoreWidth);
+		if (score > bestScore) { bestScore = score; image = candidate; chosen = candidateFrame; timestamp = reader->GetTimestamp(); }
+	}
+
+	return true;
+}
+
+/**
+ * @brief Pass the frame through the selectors
+ * @param image The decoded frame
+ * @return true If every selector keeps the frame
+ * @return false If any selector drops the frame
+ */
+bool Pipeline::Accept(Mat& image)
+{
+	for (auto selector : _selectors) if (!selector->Accept(image)) return false;
+	return true;
+}
+
+//--------------------------------------------------
+// Error Handling
+//--------------------------------------------------
+
+/**
+ * @brief Record the current exception and stop the pipeline
+ */
+void Pipeline::Fail()
+{
+	{
+		auto guard = unique_lock<mutex>(_errorLock);
+		if (!_error) _error = current_exception();
+	}
+
+	{
+		auto guard = unique_lock<mutex>(_orderLock);
+		_failed = true;
+	}
+
+	_orderChanged.notify_all();
+	_decoded.Close();
+}
+
+//--------------------------------------------------
+// Reporting
+//--------------------------------------------------
+
+/**
+ * @brief Report the progress of the pipeline periodically while it runs
+ * @param reporter Receives each report (a single-line JSON object), on the reporting thread
+ * @param interval The number of seconds between reports (0 for none)
+ * @param frameCount The estimated number of frames in the video (used for the time remaining)
+ */
+void Pipeline::SetReporter(function<void(const string&)> reporter, double interval, double frameCount)
+{
+	_reporter = reporter; _interval = interval;
+
+	auto probes = 0LL;
+	for (auto segment : _segments) 
+	{
+		auto end = (int)min((double)segment->GetEndFrame(), frameCount);
+		if (end > segment->GetFirstFrame()) probes += _sampler->GetFirstProbe(end) - _sampler->GetFirstProbe(segment->GetFirstFrame());
+	}
+	_metrics.SetExpectedProbes(probes);
+}
+
+/**
+ * @brief Describe the whole run (call once Run() has returned)
+ * @return string A single-line JSON object
+ */
+string Pipeline::GetSummary()
+{
+	return _metrics.GetSummary(GetSeekCount());
+}
+
+/**
+ * @brief Send a report every interval until the pipeline finishes
+ * @remarks Reports are built from counters and queue sizes, so the workers never wait on the reporter.
+ */
+void Pipeline::Report()
+{
+	auto guard = unique_lock<mutex>(_reportLock);
+
+	while (!_reportChanged.wait_for(guard, chrono::duration<double>(_interval), [this] { return _reportDone; }))
+	{
+		auto pending = size_t(0);
+		{
+			auto order = lock_guard<mutex>(_orderLock); pending = _pending.size();
+		}
+
+		try { _reporter(_metrics.GetProgress(_decoded.Size(), pending, GetSeekCount())); } catch (...) {}
+	}
+}
+
+/**
+ * @brief Retrieve the number of seeks made by all the segment readers
+ * @return int The number of seeks
+ */
+int Pipeline::GetSeekCount()
+{
+	auto result = 0;
+	for (auto segment : _segments) result += segment->GetReader()->GetSeekCount();
+	return result;
+}
@@ -0,0 +1,91 @@
+//--------------------------------------------------
+// Utility: Decodes frames on one thread per segment and encodes them on a pool of threads
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <exception>
+#include <condition_variable>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "Segment.h"
+#include "FramePacket.h"
+#include "FrameSink.h"
+#include "FrameSelector.h"
+#include "FrameSampler.h"
+#include "SharpnessScorer.h"
+#include "FrameCorrector.h"
+#include "ZipWriter.h"
+#include "BlockingQueue.h"
+#include "ResourceBudget.h"
+#include "PipelineMetrics.h"
+
+namespace NVL_Module
+{
+	class Pipeline
+	{
+	private:
+		vector<Segment *> _segments;
+		FrameSink * _sink;
+		vector<FrameSelector *> _selectors;
+		FrameSampler * _sampler;
+		int _window;
+		int _scoreWidth;
+		FrameCorrector * _corrector;
+		int _quality;
+		int _encoderCount;
+		int _capacity;
+
+		BlockingQueue<FramePacket *> _decoded;
+
+		mutex _orderLock;
+		condition_variable _orderChanged;
+		map<pair<int, int>, FramePacket *> _pending;
+		int _written;
+
+		mutex _errorLock;
+		exception_ptr _error;
+		atomic<bool> _failed;
+		atomic<int> _decoding;
+
+		PipelineMetrics _metrics;
+		function<void(const string&)> _reporter;
+		double _interval;
+		mutex _reportLock;
+		condition_variable _reportChanged;
+		bool _reportDone;
+	public:
+		Pipeline(vector<Segment *>& segments, FrameSink * sink, vector<FrameSelector *>& selectors, FrameSampler * sampler, int quality, int encoderCount, int capacity);
+		~Pipeline();
+
+		int Run();
+
+		void SetWindow(int window, int scoreWidth) { _window = window; _scoreWidth = scoreWidth; }
+		void SetCorrector(FrameCorrector * corrector) { _corrector = corrector; }
+		void SetReporter(function<void(const string&)> reporter, double interval, double frameCount);
+		string GetSummary();
+	private:
+		bool Read(Segment * segment, int frame, Mat& image, int& chosen, double& timestamp);
+		bool Accept(Mat& image);
+		void Decode(Segment * segment);
+		void Encode();
+		void Submit(FramePacket * packet);
+		void Fail();
+		void Report();
+		int GetSeekCount();
+	};
+}
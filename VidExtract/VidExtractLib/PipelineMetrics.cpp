@@ -0,0 +1,107 @@
+//--------------------------------------------------
+// Implementation of class PipelineMetrics
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "PipelineMetrics.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ */
+PipelineMetrics::PipelineMetrics() : _expectedProbes(0), _probed(0), _decoded(0), _encoded(0), _written(0), _bytes(0), _lastTime(0), _lastDecoded(0), _lastEncoded(0)
+{
+	Start();
+}
+
+/**
+ * @brief Restart the clock (called when the pipeline starts)
+ */
+void PipelineMetrics::Start()
+{
+	_start = chrono::steady_clock::now();
+}
+
+//--------------------------------------------------
+// Reports
+//--------------------------------------------------
+
+/**
+ * @brief Describe the progress since the last report
+ * @param decodeQueue The number of frames waiting for an encoder
+ * @param reorderQueue The number of encoded frames waiting for their turn to be written
+ * @param seekCount The number of seeks so far
+ * @return string A single-line JSON object
+ * @remarks The rates cover the interval since the previous report, so they show stalls as they happen.
+ * This is only called from the reporting thread.
+ */
+string PipelineMetrics::GetProgress(size_t decodeQueue, size_t reorderQueue, int seekCount)
+{
+	auto elapsed = GetElapsed(); auto interval = max(elapsed - _lastTime, 1e-6);
+	long long decoded = _decoded; long long encoded = _encoded;
+
+	auto result = stringstream(); result << fixed << setprecision(2);
+	result << "{\"elapsed_s\":" << elapsed;
+	result << ",\"decode_fps\":" << (decoded - _lastDecoded) / interval;
+	result << ",\"encode_fps\":" << (encoded - _lastEncoded) / interval;
+	result << ",\"decode_queue\":" << decodeQueue << ",\"reorder_queue\":" << reorderQueue;
+	result << ",\"probed\":" << (long long)_probed << ",\"written\":" << (long long)_written << ",\"bytes\":" << (long long)_bytes;
+	result << ",\"seeks\":" << seekCount << ",\"eta_s\":" << GetRemaining(elapsed) << "}";
+
+	_lastTime = elapsed; _lastDecoded = decoded; _lastEncoded = encoded;
+
+	return result.str();
+}
+
+/**
+ * @brief Describe the whole run
+ * @param seekCount The number of seeks that were made
+ * @return string A single-line JSON object
+ */
+string PipelineMetrics::GetSummary(int seekCount)
+{
+	auto elapsed = GetElapsed(); auto seconds = max(elapsed, 1e-6);
+
+	auto result = stringstream(); result << fixed << setprecision(2);
+	result << "{\"elapsed_s\":" << elapsed;
+	result << ",\"probed\":" << (long long)_probed << ",\"decoded\":" << (long long)_decoded << ",\"encoded\":" << (long long)_encoded;
+	result << ",\"written\":" << (long long)_written << ",\"bytes\":" << (long long)_bytes;
+	result << ",\"decode_fps\":" << _decoded / seconds << ",\"encode_fps\":" << _encoded / seconds;
+	result << ",\"write_mb_s\":" << _bytes / seconds / (1024.0 * 1024.0) << ",\"seeks\":" << seekCount << "}";
+
+	return result.str();
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the number of seconds since the start
+ * @return double The elapsed time
+ */
+double PipelineMetrics::GetElapsed()
+{
+	return chrono::duration<double>(chrono::steady_clock::now() - _start).count();
+}
+
+/**
+ * @brief Estimate the number of seconds remaining from the fraction of the sampling points read so far
+ * @param elapsed The elapsed time
+ * @return double The estimate (-1 when there is nothing to go on yet)
+ */
+double PipelineMetrics::GetRemaining(double elapsed)
+{
+	long long probed = _probed;
+	if (probed == 0 || _expectedProbes <= 0) return -1;
+
+	auto fraction = min(1.0, (double)probed / _expectedProbes);
+	return elapsed * (1.0 - fraction) / fraction;
+}
@@ -0,0 +1,54 @@
+//--------------------------------------------------
+// Utility: Counts the work done by the extraction pipeline and reports it as JSON
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+using namespace std;
+
+namespace NVL_Module
+{
+	class PipelineMetrics
+	{
+	private:
+		chrono::steady_clock::time_point _start;
+		long long _expectedProbes;
+
+		atomic<long long> _probed;
+		atomic<long long> _decoded;
+		atomic<long long> _encoded;
+		atomic<long long> _written;
+		atomic<long long> _bytes;
+
+		double _lastTime;
+		long long _lastDecoded;
+		long long _lastEncoded;
+	public:
+		PipelineMetrics();
+
+		void Start();
+		string GetProgress(size_t decodeQueue, size_t reorderQueue, int seekCount);
+		string GetSummary(int seekCount);
+
+		inline void AddProbe() { _probed++; }
+		inline void AddDecoded() { _decoded++; }
+		inline void AddEncoded() { _encoded++; }
+		inline void AddWritten(size_t bytes) { _written++; _bytes += (long long)bytes; }
+
+		inline void SetExpectedProbes(long long expectedProbes) { _expectedProbes = expectedProbes; }
+		inline long long GetWritten() { return _written; }
+		inline long long GetBytes() { return _bytes; }
+	private:
+		double GetElapsed();
+		double GetRemaining(double elapsed);
+	};
+}
@@ -0,0 +1,70 @@
+//--------------------------------------------------
+// Implementation of class ResourceBudget
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ResourceBudget.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Token Pool
+//--------------------------------------------------
+
+/**
+ * @brief Set the number of tokens in the pool
+ * @param count The number of tokens (zero or less leaves the pool unlimited)
+ */
+void TokenPool::Configure(int count)
+{
+	auto guard = unique_lock<mutex>(_lock);
+	_limited = count > 0; _available = count;
+}
+
+/**
+ * @brief Take a token, waiting until one is free
+ */
+void TokenPool::Acquire()
+{
+	auto guard = unique_lock<mutex>(_lock);
+	if (!_limited) return;
+	_released.wait(guard, [this] { return _available > 0; });
+	_available--;
+}
+
+/**
+ * @brief Return a token to the pool
+ */
+void TokenPool::Release()
+{
+	auto guard = unique_lock<mutex>(_lock);
+	if (!_limited) return;
+	_available++;
+	_released.notify_one();
+}
+
+//--------------------------------------------------
+// Budget
+//--------------------------------------------------
+
+/**
+ * @brief Retrieve the budget shared by every module instance in the process
+ * @return ResourceBudget& The shared budget
+ */
+ResourceBudget& ResourceBudget::GetInstance()
+{
+	static auto instance = ResourceBudget();
+	return instance;
+}
+
+/**
+ * @brief Set the limits (only the first call has an effect, so concurrent extractions agree on one budget)
+ * @param threads The number of frames that may be encoded at once across all extractions
+ * @param writers The number of frames that may be written at once across all extractions
+ */
+void ResourceBudget::Configure(int threads, int writers)
+{
+	call_once(_configured, [&] { _cpu.Configure(threads); _io.Configure(writers); });
+}
@@ -0,0 +1,56 @@
+//--------------------------------------------------
+// Utility: Process-wide limits on the encoder threads and writers, shared by every extraction
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <mutex>
+#include <condition_variable>
+#include <iostream>
+using namespace std;
+
+namespace NVL_Module
+{
+	class TokenPool
+	{
+	private:
+		int _available;
+		bool _limited;
+		mutex _lock;
+		condition_variable _released;
+	public:
+		TokenPool() : _available(0), _limited(false) {}
+
+		void Configure(int count);
+		void Acquire();
+		void Release();
+	};
+
+	class TokenGuard
+	{
+	private:
+		TokenPool& _pool;
+	public:
+		TokenGuard(TokenPool& pool) : _pool(pool) { _pool.Acquire(); }
+		~TokenGuard() { _pool.Release(); }
+	};
+
+	class ResourceBudget
+	{
+	private:
+		TokenPool _cpu;
+		TokenPool _io;
+		once_flag _configured;
+	public:
+		static ResourceBudget& GetInstance();
+
+		void Configure(int threads, int writers);
+
+		inline TokenPool& GetCpu() { return _cpu; }
+		inline TokenPool& GetIo() { return _io; }
+	};
+}
@@ -0,0 +1,70 @@
+//--------------------------------------------------
+// Implementation of class Segment
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "Segment.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param id The identifier of the segment
+ * @param reader The reader that decodes this segment (owned by the segment)
+ * @param firstFrame The first frame of the segment (a sampling point)
+ * @param endFrame The frame after the last frame of the segment
+ * @param firstIndex The output index of the first frame (the number of its sampling point)
+ */
+Segment::Segment(int id, FrameReader * reader, int firstFrame, int endFrame, int firstIndex) :
+	_id(id), _reader(reader), _firstFrame(firstFrame), _endFrame(endFrame), _nextIndex(firstIndex)
+{
+	// Extra implementation can go here
+}
+
+/**
+ * @brief Main Terminator
+ */
+Segment::~Segment()
+{
+	delete _reader;
+}
+
+//--------------------------------------------------
+// Planning
+//--------------------------------------------------
+
+/**
+ * @brief Split the video into ranges that can be decoded in parallel
+ * @param frameCount The (estimated) number of frames in the video
+ * @param frameStep The number of frames between extracted frames
+ * @param gopSize The estimated keyframe interval (used when there is no index)
+ * @param index The packet index of the video (nullptr for none)
+ * @param count The number of segments that we want
+ * @param ranges The [first, end) frame ranges (the last range runs to the end of the video)
+ * @remarks Boundaries are placed on a keyframe (the last one before the even split when there is an index,
+ * otherwise the nearest multiple of the keyframe interval) and then moved up to the next extracted frame, so
+ * each decoder starts close to a keyframe and the output numbering is the same as a single pass.
+ */
+void Segment::Plan(double frameCount, int frameStep, int gopSize, FrameIndex * index, int count, vector<Vec2i>& ranges)
+{
+	auto boundaries = vector<int> { 0 }; auto interval = max(gopSize, 1);
+
+	for (auto i = 1; i < count; i++)
+	{
+		auto boundary = (int)(frameCount * i / count);
+		if (index != nullptr && boundary < index->GetCount()) boundary = index->GetKeyframe(boundary);
+		else boundary = ((boundary + interval / 2) / interval) * interval;
+		boundary = ((boundary + frameStep - 1) / frameStep) * frameStep;
+		if (boundary > boundaries.back() && boundary < frameCount) boundaries.push_back(boundary);
+	}
+
+	boundaries.push_back(INT_MAX);
+
+	for (auto i = 0; i < (int)boundaries.size() - 1; i++) ranges.push_back(Vec2i(boundaries[i], boundaries[i + 1]));
+}
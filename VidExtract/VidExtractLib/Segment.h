@@ -0,0 +1,39 @@
+//--------------------------------------------------
+// Model: A range of frames that is decoded independently of the rest of the video
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <climits>
+#include <iostream>
+using namespace std;
+
+#include "FrameReader.h"
+
+namespace NVL_Module
+{
+	class Segment
+	{
+	private:
+		int _id;
+		FrameReader * _reader;
+		int _firstFrame;
+		int _endFrame;
+		int _nextIndex;
+	public:
+		Segment(int id, FrameReader * reader, int firstFrame, int endFrame, int firstIndex);
+		~Segment();
+
+		static void Plan(double frameCount, int frameStep, int gopSize, FrameIndex * index, int count, vector<Vec2i>& ranges);
+
+		inline int& GetId() { return _id; }
+		inline FrameReader * GetReader() { return _reader; }
+		inline int& GetFirstFrame() { return _firstFrame; }
+		inline int& GetEndFrame() { return _endFrame; }
+		inline int& GetNextIndex() { return _nextIndex; }
+	};
+}
@@ -0,0 +1,32 @@
+//--------------------------------------------------
+// Utility: Scores the sharpness of a frame as the variance of the Laplacian of its luma
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace NVL_Module
+{
+	class SharpnessScorer
+	{
+	public:
+		static double GetScore(Mat& image, int width);
+		static double GetScore(Mat& gray);
+	private:
+		static void AccumulateRow(const uchar * above, const uchar * row, const uchar * below, int columns, int64_t& sum, int64_t& squares);
+	};
+}
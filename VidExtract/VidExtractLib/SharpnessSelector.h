@@ -0,0 +1,45 @@
+//--------------------------------------------------
+// Selector: Drops frames that are too blurred
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+using namespace std;
+
+#include "FrameSelector.h"
+#include "SharpnessScorer.h"
+
+namespace NVL_Module
+{
+	class SharpnessSelector : public FrameSelector
+	{
+	private:
+		double _minSharpness;
+		int _width;
+	public:
+		SharpnessSelector(double minSharpness, int width) : _minSharpness(minSharpness), _width(width) {}
+
+		/**
+		 * @brief Keep the frame if its sharpness score reaches the threshold
+		 * @param image The decoded frame
+		 * @return true If the frame is sharp enough
+		 * @return false If the frame is too blurred
+		 */
+		virtual bool Accept(Mat& image) override 
+		{
+			return SharpnessScorer::GetScore(image, _width) >= _minSharpness;
+		}
+
+		/**
+		 * @brief Dropped frames shift the numbering of every later frame, so the output of a segment can only be
+		 * numbered once all the frames before it are known
+		 * @return true The whole video is decoded by a single segment
+		 */
+		virtual bool IsSequential() override { return true; }
+	};
+}
@@ -0,0 +1,31 @@
+//--------------------------------------------------
+// Sampler: Samples every n-th frame
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <iostream>
+#include <algorithm>
+using namespace std;
+
+#include "FrameSampler.h"
+
+namespace NVL_Module
+{
+	class StepSampler : public FrameSampler
+	{
+	private:
+		int _frameStep;
+	public:
+		StepSampler(int frameStep) : _frameStep(max(frameStep, 1)) {}
+
+		virtual int GetFrame(int probe) override { return probe < INT_MAX / _frameStep ? probe * _frameStep : INT_MAX; }
+		virtual int GetFirstProbe(int frame) override { return frame >= INT_MAX - _frameStep ? INT_MAX / _frameStep : (frame + _frameStep - 1) / _frameStep; }
+		virtual int GetProbe(int frame) override { return (frame + _frameStep / 2) / _frameStep; }
+		virtual int GetMinGap() override { return _frameStep; }
+	};
+}
@@ -0,0 +1,40 @@
+//--------------------------------------------------
+// Model: A frame read back from a VidExtract stream
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <iostream>
+using namespace std;
+
+namespace NVL_Module
+{
+	class StreamFrame
+	{
+	private:
+		int _format;
+		int _index;
+		int _frame;
+		double _timestamp;
+		int _width;
+		int _height;
+		int _channels;
+		vector<unsigned char> _payload;
+	public:
+		StreamFrame() : _format(0), _index(0), _frame(0), _timestamp(0), _width(0), _height(0), _channels(0) {}
+
+		inline int& GetFormat() { return _format; }
+		inline int& GetIndex() { return _index; }
+		inline int& GetFrame() { return _frame; }
+		inline double& GetTimestamp() { return _timestamp; }
+		inline int& GetWidth() { return _width; }
+		inline int& GetHeight() { return _height; }
+		inline int& GetChannels() { return _channels; }
+		inline vector<unsigned char>& GetPayload() { return _payload; }
+	};
+}
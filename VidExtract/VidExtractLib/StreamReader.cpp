@@ -0,0 +1,89 @@
+//--------------------------------------------------
+// Implementation of class StreamReader
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "StreamReader.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param source Where the stream comes from ("-" for stdin, otherwise a path such as a named pipe)
+ */
+StreamReader::StreamReader(const string& source) : _source(source), _file(nullptr)
+{
+	_file = source == "-" ? stdin : fopen(source.c_str(), "rb");
+	if (_file == nullptr) throw runtime_error("Unable to open: " + source);
+}
+
+/**
+ * @brief Main Terminator
+ */
+StreamReader::~StreamReader()
+{
+	if (_file != nullptr && _file != stdin) fclose(_file);
+}
+
+//--------------------------------------------------
+// Read
+//--------------------------------------------------
+
+/**
+ * @brief Read the next frame (blocking until it arrives)
+ * @param frame The frame that was read
+ * @return true If a frame was read
+ * @return false If the stream ended cleanly between frames
+ */
+bool StreamReader::Read(StreamFrame& frame)
+{
+	unsigned char header[STREAM_HEADER_SIZE];
+	auto count = fread(header, 1, STREAM_HEADER_SIZE, _file);
+	if (count == 0) return false;
+	if (count != STREAM_HEADER_SIZE || Get32(header) != STREAM_MAGIC) throw runtime_error("Corrupt frame header in: " + _source);
+
+	auto timestampBits = (uint64_t)Get32(header + 16) | ((uint64_t)Get32(header + 20) << 32);
+	memcpy(&frame.GetTimestamp(), &timestampBits, sizeof(timestampBits));
+
+	frame.GetFormat() = (int)Get32(header + 4); frame.GetIndex() = (int)Get32(header + 8); frame.GetFrame() = (int)Get32(header + 12);
+	frame.GetWidth() = (int)Get32(header + 24); frame.GetHeight() = (int)Get32(header + 28); frame.GetChannels() = (int)Get32(header + 32);
+
+	frame.GetPayload().resize(Get32(header + 36));
+	if (fread(frame.GetPayload().data(), 1, frame.GetPayload().size(), _file) != frame.GetPayload().size()) throw runtime_error("Truncated frame in: " + _source);
+
+	return true;
+}
+
+/**
+ * @brief Convert a frame into an image
+ * @param frame The frame that was read
+ * @return Mat The image (raw frames share the payload, so it must outlive the image)
+ */
+Mat StreamReader::GetImage(StreamFrame& frame)
+{
+	auto& payload = frame.GetPayload();
+	if (frame.GetFormat() == STREAM_FORMAT_JPEG) return imdecode(Mat(1, (int)payload.size(), CV_8UC1, payload.data()), IMREAD_COLOR);
+
+	if ((size_t)frame.GetWidth() * frame.GetHeight() * frame.GetChannels() != payload.size()) throw runtime_error("The raw frame does not match its size");
+	return Mat(frame.GetHeight(), frame.GetWidth(), CV_8UC(frame.GetChannels()), payload.data());
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Read a little-endian 32-bit value
+ * @param bytes The location of the value
+ * @return uint32_t The resultant value
+ */
+uint32_t StreamReader::Get32(const unsigned char * bytes)
+{
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
@@ -0,0 +1,39 @@
+//--------------------------------------------------
+// Utility: Reads the frames of a VidExtract stream (for the tools that consume it)
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "StreamSink.h"
+#include "StreamFrame.h"
+
+namespace NVL_Module
+{
+	class StreamReader
+	{
+	private:
+		string _source;
+		FILE * _file;
+	public:
+		StreamReader(const string& source);
+		~StreamReader();
+
+		bool Read(StreamFrame& frame);
+
+		static Mat GetImage(StreamFrame& frame);
+	private:
+		static uint32_t Get32(const unsigned char * bytes);
+	};
+}
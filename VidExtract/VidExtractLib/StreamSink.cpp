@@ -0,0 +1,108 @@
+//--------------------------------------------------
+// Implementation of class StreamSink
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "StreamSink.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param target Where the stream goes ("-" for stdout, otherwise a path such as a named pipe)
+ * @param format The payload format (STREAM_FORMAT_JPEG or STREAM_FORMAT_RAW)
+ * @remarks Opening a named pipe blocks until the consumer opens it. SIGPIPE is ignored so that a consumer
+ * that goes away shows up as a write error rather than ending the process.
+ */
+StreamSink::StreamSink(const string& target, int format) : _target(target), _file(nullptr), _format(format)
+{
+	signal(SIGPIPE, SIG_IGN);
+
+	_file = target == "-" ? stdout : fopen(target.c_str(), "wb");
+	if (_file == nullptr) throw runtime_error("Unable to open: " + target);
+}
+
+/**
+ * @brief Main Terminator
+ */
+StreamSink::~StreamSink()
+{
+	if (_file != nullptr && _file != stdout) fclose(_file);
+}
+
+//--------------------------------------------------
+// Write
+//--------------------------------------------------
+
+/**
+ * @brief Write the header and the payload of a frame, and flush them so the consumer sees the frame at once
+ * @param packet The packet that we are writing
+ */
+void StreamSink::Write(FramePacket * packet)
+{
+	auto& image = packet->GetImage(); auto& buffer = packet->GetBuffer();
+	auto raw = _format == STREAM_FORMAT_RAW;
+	if (raw && !image.isContinuous()) throw runtime_error("Raw frames must be continuous");
+
+	auto payload = raw ? (const unsigned char *) image.data : buffer.data();
+	auto length = raw ? image.total() * image.elemSize() : buffer.size();
+	if (length > 0xFFFFFFFFull) throw runtime_error("Frame is too large for the stream");
+
+	uint64_t timestampBits; memcpy(&timestampBits, &packet->GetTimestamp(), sizeof(timestampBits));
+
+	unsigned char header[STREAM_HEADER_SIZE];
+	Put32(header, STREAM_MAGIC); Put32(header + 4, (uint32_t)_format);
+	Put32(header + 8, (uint32_t)packet->GetIndex()); Put32(header + 12, (uint32_t)packet->GetFrame());
+	Put32(header + 16, (uint32_t)(timestampBits & 0xFFFFFFFF)); Put32(header + 20, (uint32_t)(timestampBits >> 32));
+	Put32(header + 24, raw ? (uint32_t)image.cols : 0); Put32(header + 28, raw ? (uint32_t)image.rows : 0);
+	Put32(header + 32, raw ? (uint32_t)image.channels() : 0); Put32(header + 36, (uint32_t)length);
+
+	WriteBytes(header, STREAM_HEADER_SIZE);
+	WriteBytes(payload, length);
+	if (fflush(_file) != 0) throw runtime_error("Unable to write to: " + _target);
+}
+
+/**
+ * @brief Flush the stream and close it (stdout is left open)
+ */
+void StreamSink::Close()
+{
+	if (_file == nullptr) return;
+
+	auto failed = fflush(_file) != 0;
+	if (_file != stdout) failed = fclose(_file) != 0 || failed;
+	_file = nullptr;
+
+	if (failed) throw runtime_error("Unable to finish writing: " + _target);
+}
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Write a block of bytes to the stream
+ * @param data The bytes that we are writing
+ * @param size The number of bytes
+ */
+void StreamSink::WriteBytes(const void * data, size_t size)
+{
+	if (size > 0 && fwrite(data, 1, size, _file) != size) throw runtime_error("Unable to write to (the consumer may have closed it): " + _target);
+}
+
+/**
+ * @brief Place a little-endian 32-bit value
+ * @param bytes The location of the value
+ * @param value The value that we are placing
+ */
+void StreamSink::Put32(unsigned char * bytes, uint32_t value)
+{
+	bytes[0] = (unsigned char)(value & 0xFF); bytes[1] = (unsigned char)((value >> 8) & 0xFF);
+	bytes[2] = (unsigned char)((value >> 16) & 0xFF); bytes[3] = (unsigned char)(value >> 24);
+}
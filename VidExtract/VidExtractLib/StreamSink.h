@@ -0,0 +1,52 @@
+//--------------------------------------------------
+// Sink: Streams each frame with a small header to stdout or a named pipe
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+#include "FrameSink.h"
+
+//--------------------------------------------------
+// Layout
+//--------------------------------------------------
+//
+// Every frame is preceded by a 40-byte header: magic "VXFR", format (u32: 0 = JPEG, 1 = raw), output index (u32),
+// source frame (u32), timestamp in ms (f64), width (u32), height (u32), channels (u32) and payload length (u32).
+// Raw payloads are 8-bit interleaved (BGR for color) rows without padding. All values are little-endian.
+
+#define STREAM_MAGIC 0x52465856u
+#define STREAM_HEADER_SIZE 40
+#define STREAM_FORMAT_JPEG 0
+#define STREAM_FORMAT_RAW 1
+
+namespace NVL_Module
+{
+	class StreamSink : public FrameSink
+	{
+	private:
+		string _target;
+		FILE * _file;
+		int _format;
+	public:
+		StreamSink(const string& target, int format);
+		~StreamSink();
+
+		virtual void Write(FramePacket * packet) override;
+		virtual void Close() override;
+
+		virtual bool IsEncoded() override { return _format == STREAM_FORMAT_JPEG; }
+	private:
+		void WriteBytes(const void * data, size_t size);
+		static void Put32(unsigned char * bytes, uint32_t value);
+	};
+}
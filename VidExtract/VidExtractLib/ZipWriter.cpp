@@ -0,0 +1,264 @@
+//--------------------------------------------------
+// Implementation of class ZipWriter
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include "ZipWriter.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Constants
+//--------------------------------------------------
+
+#define ZIP_LOCAL_SIGNATURE 0x04034b50
+#define ZIP_CENTRAL_SIGNATURE 0x02014b50
+#define ZIP_END_SIGNATURE 0x06054b50
+#define ZIP64_END_SIGNATURE 0x06064b50
+#define ZIP64_LOCATOR_SIGNATURE 0x07064b50
+#define ZIP_VERSION 45
+#define ZIP_MAX_16 0xFFFF
+#define ZIP_MAX_32 0xFFFFFFFFull
+
+//--------------------------------------------------
+// Constructors and Terminators
+//--------------------------------------------------
+
+/**
+ * @brief Main Constructor
+ * @param path The path to the archive that we are creating (it is replaced if it exists)
+ */
+ZipWriter::ZipWriter(const string& path) : _path(path), _offset(0)
+{
+	_writer.open(path, ios::binary | ios::trunc);
+	if (!_writer.is_open()) throw runtime_error("Unable to open: " + path);
+
+	SetTimestamp();
+}
+
+/**
+ * @brief Append Constructor
+ * @param path The path to an archive that was left unfinished
+ * @param entries The entries at the start of the archive that are kept (in file order)
+ * @remarks Anything after the kept entries (a partial entry or an old central directory) is cut off, and
+ * new entries are appended from there.
+ */
+ZipWriter::ZipWriter(const string& path, const vector<ZipEntry>& entries) : _path(path), _entries(entries), _offset(0)
+{
+	if (!_entries.empty()) _offset = _entries.back().GetOffset() + 30 + _entries.back().GetName().size() + _entries.back().GetSize();
+
+	if (_offset > 0) 
+	{
+		filesystem::resize_file(path, _offset);
+		_writer.open(path, ios::binary | ios::in | ios::out);
+		_writer.seekp(_offset);
+	}
+	else _writer.open(path, ios::binary | ios::trunc);
+
+	if (!_writer.is_open()) throw runtime_error("Unable to open: " + path);
+
+	SetTimestamp();
+}
+
+/**
+ * @brief Main Terminator
+ */
+ZipWriter::~ZipWriter()
+{
+	if (_writer.is_open()) _writer.close();
+}
+
+//--------------------------------------------------
+// Writing
+//--------------------------------------------------
+
+/**
+ * @brief Append a stored entry to the archive
+ * @param name The name of the entry
+ * @param data The content of the entry
+ * @param size The number of bytes in the entry
+ * @return uint64_t The offset of the entry's local header within the archive
+ */
+uint64_t ZipWriter::Add(const string& name, const unsigned char * data, size_t size)
+{
+	return Add(name, data, size, GetCrc32(data, size));
+}
+
+/**
+ * @brief Append a stored entry whose checksum is already known
+ * @param name The name of the entry
+ * @param data The content of the entry
+ * @param size The number of bytes in the entry
+ * @param crc The CRC-32 of the content
+ * @return uint64_t The offset of the entry's local header within the archive
+ */
+uint64_t ZipWriter::Add(const string& name, const unsigned char * data, size_t size, uint32_t crc)
+{
+	if (size >= ZIP_MAX_32) throw runtime_error("Zip entry is too large: " + name);
+
+	_entries.push_back(ZipEntry(name, crc, size, _offset));
+	auto& entry = _entries.back();
+
+	WriteLocalHeader(entry);
+	_writer.write((const char *) data, size);
+	if (!_writer) throw runtime_error("Unable to write to: " + _path);
+
+	_offset += 30 + name.size() + size;
+
+	return entry.GetOffset();
+}
+
+/**
+ * @brief Write the central directory and close the archive
+ */
+void ZipWriter::Close()
+{
+	auto directoryOffset = _offset;
+	for (auto& entry : _entries) WriteCentralHeader(entry);
+	auto directorySize = (uint64_t)_writer.tellp() - directoryOffset;
+
+	WriteEnd(directoryOffset, directorySize);
+
+	_writer.close();
+	if (_writer.fail()) throw runtime_error("Unable to finish writing: " + _path);
+}
+
+//--------------------------------------------------
+// Records
+//--------------------------------------------------
+
+/**
+ * @brief Set the modification time that is stamped on the entries (DOS format)
+ */
+void ZipWriter::SetTimestamp()
+{
+	auto now = time(nullptr); auto local = *localtime(&now);
+	_time = (uint16_t)((local.tm_hour << 11) | (local.tm_min << 5) | (local.tm_sec / 2));
+	_date = (uint16_t)(((local.tm_year - 80) << 9) | ((local.tm_mon + 1) << 5) | local.tm_mday);
+}
+
+/**
+ * @brief Write the header that precedes the data of an entry
+ * @param entry The entry that we are writing
+ */
+void ZipWriter::WriteLocalHeader(ZipEntry& entry)
+{
+	Write32(ZIP_LOCAL_SIGNATURE);
+	Write16(ZIP_VERSION); Write16(0); Write16(0);
+	Write16(_time); Write16(_date);
+	Write32(entry.GetCrc()); Write32((uint32_t)entry.GetSize()); Write32((uint32_t)entry.GetSize());
+	Write16((uint16_t)entry.GetName().size()); Write16(0);
+	_writer.write(entry.GetName().c_str(), entry.GetName().size());
+}
+
+/**
+ * @brief Write the central directory record of an entry
+ * @param entry The entry that we are writing
+ * @remarks Offsets beyond 4GB are moved into a ZIP64 extra field
+ */
+void ZipWriter::WriteCentralHeader(ZipEntry& entry)
+{
+	auto large = entry.GetOffset() >= ZIP_MAX_32;
+
+	Write32(ZIP_CENTRAL_SIGNATURE);
+	Write16((3 << 8) | ZIP_VERSION); Write16(ZIP_VERSION); Write16(0); Write16(0);
+	Write16(_time); Write16(_date);
+	Write32(entry.GetCrc()); Write32((uint32_t)entry.GetSize()); Write32((uint32_t)entry.GetSize());
+	Write16((uint16_t)entry.GetName().size()); Write16(large ? 12 : 0); Write16(0);
+	Write16(0); Write16(0); Write32(0100644u << 16);
+	Write32(large ? (uint32_t)ZIP_MAX_32 : (uint32_t)entry.GetOffset());
+	_writer.write(entry.GetName().c_str(), entry.GetName().size());
+
+	if (large) { Write16(0x0001); Write16(8); Write64(entry.GetOffset()); }
+}
+
+/**
+ * @brief Write the end of central directory record (and its ZIP64 form when needed)
+ * @param directoryOffset The offset of the central directory
+ * @param directorySize The size of the central directory
+ */
+void ZipWriter::WriteEnd(uint64_t directoryOffset, uint64_t directorySize)
+{
+	auto count = (uint64_t)_entries.size();
+	auto large = count >= ZIP_MAX_16 || directoryOffset >= ZIP_MAX_32 || directorySize >= ZIP_MAX_32;
+
+	if (large)
+	{
+		auto recordOffset = directoryOffset + directorySize;
+
+		Write32(ZIP64_END_SIGNATURE); Write64(44);
+		Write16(ZIP_VERSION); Write16(ZIP_VERSION); Write32(0); Write32(0);
+		Write64(count); Write64(count); Write64(directorySize); Write64(directoryOffset);
+
+		Write32(ZIP64_LOCATOR_SIGNATURE); Write32(0); Write64(recordOffset); Write32(1);
+	}
+
+	Write32(ZIP_END_SIGNATURE); Write16(0); Write16(0);
+	Write16(large ? ZIP_MAX_16 : (uint16_t)count); Write16(large ? ZIP_MAX_16 : (uint16_t)count);
+	Write32(large ? (uint32_t)ZIP_MAX_32 : (uint32_t)directorySize);
+	Write32(large ? (uint32_t)ZIP_MAX_32 : (uint32_t)directoryOffset);
+	Write16(0);
+}
+
+//--------------------------------------------------
+// Checksum
+//--------------------------------------------------
+
+/**
+ * @brief Calculate the CRC-32 (as used by zip) of the given data
+ * @param data The data that we are checking
+ * @param size The number of bytes
+ * @return uint32_t The resultant checksum
+ */
+uint32_t ZipWriter::GetCrc32(const unsigned char * data, size_t size)
+{
+	static auto table = []
+	{
+		auto result = vector<uint32_t>(256);
+		for (uint32_t i = 0; i < 256; i++)
+		{
+			auto value = i;
+			for (auto bit = 0; bit < 8; bit++) value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+			result[i] = value;
+		}
+		return result;
+	}();
+
+	auto crc = 0xFFFFFFFFu;
+	for (size_t i = 0; i < size; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return crc ^ 0xFFFFFFFFu;
+}
+
+//--------------------------------------------------
+// Little-endian Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Write a 16-bit value
+ * @param value The value that we are writing
+ */
+void ZipWriter::Write16(uint16_t value)
+{
+	unsigned char bytes[2] = { (unsigned char)(value & 0xFF), (unsigned char)(value >> 8) };
+	_writer.write((const char *) bytes, 2);
+}
+
+/**
+ * @brief Write a 32-bit value
+ * @param value The value that we are writing
+ */
+void ZipWriter::Write32(uint32_t value)
+{
+	Write16((uint16_t)(value & 0xFFFF)); Write16((uint16_t)(value >> 16));
+}
+
+/**
+ * @brief Write a 64-bit value
+ * @param value The value that we are writing
+ */
+void ZipWriter::Write64(uint64_t value)
+{
+	Write32((uint32_t)(value & 0xFFFFFFFF)); Write32((uint32_t)(value >> 32));
+}
@@ -0,0 +1,70 @@
+//--------------------------------------------------
+// Utility: Streams uncompressed (stored) entries into a zip archive
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#pragma once
+
+#include <ctime>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <filesystem>
+#include <iostream>
+using namespace std;
+
+namespace NVL_Module
+{
+	class ZipEntry
+	{
+	private:
+		string _name;
+		uint32_t _crc;
+		uint64_t _size;
+		uint64_t _offset;
+	public:
+		ZipEntry(const string& name, uint32_t crc, uint64_t size, uint64_t offset) : _name(name), _crc(crc), _size(size), _offset(offset) {}
+
+		inline string& GetName() { return _name; }
+		inline uint32_t& GetCrc() { return _crc; }
+		inline uint64_t& GetSize() { return _size; }
+		inline uint64_t& GetOffset() { return _offset; }
+	};
+
+	class ZipWriter
+	{
+	private:
+		string _path;
+		ofstream _writer;
+		vector<ZipEntry> _entries;
+		uint64_t _offset;
+		uint16_t _time;
+		uint16_t _date;
+	public:
+		ZipWriter(const string& path);
+		ZipWriter(const string& path, const vector<ZipEntry>& entries);
+		~ZipWriter();
+
+		uint64_t Add(const string& name, const unsigned char * data, size_t size);
+		uint64_t Add(const string& name, const unsigned char * data, size_t size, uint32_t crc);
+		void Flush() { _writer.flush(); }
+		void Close();
+
+		static uint32_t GetCrc32(const unsigned char * data, size_t size);
+
+		inline vector<ZipEntry>& GetEntries() { return _entries; }
+		inline uint64_t GetOffset() { return _offset; }
+	private:
+		void SetTimestamp();
+		void WriteLocalHeader(ZipEntry& entry);
+		void WriteCentralHeader(ZipEntry& entry);
+		void WriteEnd(uint64_t directoryOffset, uint64_t directorySize);
+
+		void Write16(uint16_t value);
+		void Write32(uint32_t value);
+		void Write64(uint64_t value);
+	};
+}
@@ -0,0 +1,113 @@
+//--------------------------------------------------
+// Unit Tests for extracting a batch of videos
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include "../../VidExtract/Engine.h"
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief A logger that keeps the lines that it is given
+ */
+class RecordLogger : public LoggerBase
+{
+private:
+    vector<string> _lines;
+public:
+    virtual void Write(const string& message) override { _lines.push_back(message); }
+    inline vector<string>& GetLines() { return _lines; }
+};
+
+/**
+ * @brief Write a short MJPG video of textured frames
+ * @param path The path of the video that we are writing
+ * @param count The number of frames in the video
+ */
+static void WriteVideo(const string& path, int count)
+{
+    auto writer = VideoWriter(path, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25, Size(64, 48));
+    for (auto i = 0; i < count; i++)
+    {
+        auto image = Mat(48, 64, CV_8UC3, Scalar::all(128));
+        for (auto row = 0; row < image.rows; row++) for (auto column = 0; column < image.cols; column++)
+        {
+            if ((row / 4 + column / 4 + i) % 2 == 0) image.at<Vec3b>(row, column) = Vec3b(255, 255, 255);
+        }
+        writer.write(image);
+    }
+    writer.release();
+}
+
+/**
+ * @brief Build the parameters of a batch run, with the defaults of the command line
+ * @param input The folder of videos
+ * @param workingFolder The folder that the output is written to
+ * @return NVLib::Parameters * The resultant parameters (owned by the engine)
+ */
+static NVLib::Parameters * GetParameters(const string& input, const string& workingFolder)
+{
+    auto values = vector<pair<string, string>>
+    {
+        { "video_file", input }, { "frame_step", "2" }, { "working_folder", workingFolder }, { "unique_name", "batch" },
+        { "seek_mode", "auto" }, { "gop_size", "250" }, { "quality", "95" }, { "threads", "0" }, { "queue_size", "16" },
+        { "segments", "0" }, { "output", "zip" }, { "selection", "step" }, { "min_parallax", "0.05" }, { "sharpness", "none" },
+        { "min_sharpness", "100" }, { "sharp_window", "2" }, { "jobs", "2" }, { "thread_budget", "2" }, { "io_slots", "0" },
+        { "calibration", "" }, { "focal", "0" }, { "crop_ratio", "1" }, { "resize_width", "0" }, { "resume", "false" },
+        { "report_interval", "0" }, { "stream_target", "-" }, { "stream_format", "jpeg" }, { "sampling", "step" },
+        { "interval_ms", "1000" }, { "frame_list", "" }, { "frame_index", "false" }
+    };
+
+    auto result = new NVLib::Parameters();
+    for (auto& value : values) result->Add(value.first, value.second);
+    return result;
+}
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a batch writes one archive and one summary line for each video of the input folder
+ */
+TEST(Engine_Test, batch_outputs)
+{
+    // Setup
+    auto input = string("Engine_Test_videos"); auto output = string("Engine_Test_output");
+    filesystem::remove_all(input); filesystem::remove_all(output);
+    filesystem::create_directories(input); filesystem::create_directories(output);
+    WriteVideo(input + "/first.avi", 10); WriteVideo(input + "/second.avi", 12); WriteVideo(input + "/third.avi", 8);
+    auto logger = RecordLogger();
+
+    // Execute
+    Engine(GetParameters(input, output), &logger).Run();
+
+    auto archives = vector<string>();
+    for (auto& entry : filesystem::directory_iterator(output)) if (entry.path().extension() == ".zip") archives.push_back(entry.path().filename().string());
+    sort(archives.begin(), archives.end());
+
+    auto jobLines = 0, totalLines = 0;
+    for (auto& line : logger.GetLines())
+    {
+        if (line.rfind("[OK] ", 0) == 0 || line.rfind("[FAILED] ", 0) == 0) jobLines++;
+        if (line.rfind("Batch Total:", 0) == 0) totalLines++;
+        ASSERT_EQ(line.rfind("[FAILED] ", 0), string::npos);
+    }
+    filesystem::remove_all(input); filesystem::remove_all(output);
+
+    // Confirm
+    ASSERT_EQ(archives, vector<string>({ "batch_first.zip", "batch_second.zip", "batch_third.zip" }));
+    ASSERT_EQ(jobLines, 3);
+    ASSERT_EQ(totalLines, 1);
+}
@@ -0,0 +1,124 @@
+//--------------------------------------------------
+// Unit Tests for undistorting, cropping and resizing frames
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/FrameCorrector.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Build the calibration of a 160x120 camera whose principal point is the centre of the image
+ * @param focal The focal length (in pixels)
+ * @param k1 The first radial distortion coefficient
+ * @param k2 The second radial distortion coefficient
+ * @return Calibration * The resultant calibration (owned by the corrector that it is given to)
+ */
+static Calibration * GetCalibration(double focal, double k1, double k2)
+{
+    Mat camera = (Mat_<double>(3, 3) << focal, 0, 80, 0, focal, 60, 0, 0, 1);
+    Mat distortion = (Mat_<double>(4, 1) << k1, k2, 0, 0);
+    return new Calibration(camera, distortion, Size(160, 120));
+}
+
+/**
+ * @brief Render a smooth 160x120 colour frame, so that the interpolation of the two paths barely differs
+ * @return Mat The resultant frame
+ */
+static Mat GetFrame()
+{
+    auto result = Mat(120, 160, CV_8UC3);
+    for (auto row = 0; row < result.rows; row++) for (auto column = 0; column < result.cols; column++)
+    {
+        auto value = 128 + 60 * sin(column * 0.1) + 50 * cos(row * 0.13);
+        result.at<Vec3b>(row, column) = Vec3b((uchar)round(value), (uchar)round(255 - value), 90);
+    }
+    return result;
+}
+
+/**
+ * @brief Find the mean absolute difference between two frames over a window
+ * @param first The first frame
+ * @param second The second frame
+ * @param region The window that is compared
+ * @return double The mean difference (over every channel)
+ */
+static double GetDifference(Mat& first, Mat& second, const Rect& region)
+{
+    auto total = 0.0;
+    for (auto row = region.y; row < region.y + region.height; row++) for (auto column = region.x; column < region.x + region.width; column++)
+    {
+        for (auto channel = 0; channel < 3; channel++) total += fabs((double)first.at<Vec3b>(row, column)[channel] - second.at<Vec3b>(row, column)[channel]);
+    }
+    return total / (3.0 * region.area());
+}
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the output has the size of the crop, scaled to the requested width
+ */
+TEST(FrameCorrector_Test, output_size)
+{
+    // Setup
+    auto corrector = FrameCorrector(GetCalibration(150, -0.1, 0.01), 0, 0.5, 40);
+    auto image = GetFrame();
+
+    // Execute
+    corrector.Apply(image);
+
+    // Confirm
+    ASSERT_EQ(corrector.GetOutput()->GetImageSize(), Size(40, 30));
+    ASSERT_EQ(image.size(), Size(40, 30));
+    ASSERT_EQ(corrector.GetOutput()->GetCamera().at<double>(0, 0), 150 * 40 / 80.0);
+}
+
+/**
+ * @brief Confirm that a camera without distortion, with no crop or resize, leaves the frame as it was
+ */
+TEST(FrameCorrector_Test, identity)
+{
+    // Setup
+    auto corrector = FrameCorrector(GetCalibration(150, 0, 0), 0, 1.0, 0);
+    auto original = GetFrame(); auto image = original.clone();
+
+    // Execute
+    corrector.Apply(image);
+
+    // Confirm
+    ASSERT_EQ(image.size(), original.size());
+    ASSERT_LT(GetDifference(image, original, Rect(0, 0, 160, 120)), 0.5);
+}
+
+/**
+ * @brief Confirm that the single remap matches undistorting, then cropping, then resizing
+ * @remarks Skipping the undistortion moves the result about 3 levels away, so the tolerance separates the two.
+ */
+TEST(FrameCorrector_Test, matches_undistort)
+{
+    // Setup
+    auto corrector = FrameCorrector(GetCalibration(150, -0.3, 0), 0, 0.75, 80);
+    auto original = GetFrame(); auto image = original.clone();
+
+    Mat camera = (Mat_<double>(3, 3) << 150, 0, 80, 0, 150, 60, 0, 0, 1);
+    Mat distortion = (Mat_<double>(4, 1) << -0.3, 0, 0, 0);
+    Mat undistorted; undistort(original, undistorted, camera, distortion, camera);
+    Mat expected; resize(undistorted(Rect(20, 15, 120, 90)), expected, Size(80, 60), 0, 0, INTER_LINEAR);
+
+    // Execute
+    corrector.Apply(image);
+
+    // Confirm
+    ASSERT_EQ(image.size(), expected.size());
+    ASSERT_LT(GetDifference(image, expected, Rect(2, 2, 76, 56)), 1.5);
+}
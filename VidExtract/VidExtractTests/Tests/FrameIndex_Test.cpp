@@ -0,0 +1,117 @@
+//--------------------------------------------------
+// Unit Tests for the packet index and the frame samplers
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/FrameIndex.h>
+#include <VidExtractLib/StepSampler.h>
+#include <VidExtractLib/ListSampler.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Build an index of 10 frames at 40ms with keyframes at 0 and 6
+ * @return FrameIndex * The resultant index
+ */
+static FrameIndex * BuildIndex()
+{
+    auto timestamps = vector<double>(); auto keyframes = vector<uint8_t>(); auto sizes = vector<uint64_t>();
+    for (auto i = 0; i < 10; i++)
+    {
+        timestamps.push_back(i * 40.0); keyframes.push_back(i == 6 ? 1 : 0); sizes.push_back(i == 6 ? 1000 : 100);
+    }
+    return new FrameIndex(timestamps, keyframes, sizes);
+}
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm the keyframe lookup and the decode cost between frames
+ */
+TEST(FrameIndex_Test, keyframes_and_cost)
+{
+    // Setup
+    auto index = BuildIndex();
+
+    // Execute
+    auto first = index->GetKeyframe(5); auto second = index->GetKeyframe(8);
+    auto cost = index->GetCost(6, 9); auto none = index->GetCost(9, 6);
+    auto gop = index->GetAverageGop();
+    delete index;
+
+    // Confirm
+    ASSERT_EQ(first, 0);
+    ASSERT_EQ(second, 6);
+    ASSERT_EQ(cost, 1200u);
+    ASSERT_EQ(none, 0u);
+    ASSERT_EQ(gop, 5);
+}
+
+/**
+ * @brief Confirm that a timestamp only maps to a frame when it is close enough
+ */
+TEST(FrameIndex_Test, find_timestamp)
+{
+    // Setup
+    auto index = BuildIndex();
+
+    // Execute
+    auto exact = index->Find(120.0); auto near = index->Find(131.0); auto between = index->Find(140.0);
+    auto nearest = index->FindNearest(1000.0);
+    delete index;
+
+    // Confirm
+    ASSERT_EQ(exact, 3);
+    ASSERT_EQ(near, 3);
+    ASSERT_EQ(between, -1);
+    ASSERT_EQ(nearest, 9);
+}
+
+/**
+ * @brief Confirm that the list sampler orders its frames and finds the probes around a frame
+ */
+TEST(FrameIndex_Test, list_sampler)
+{
+    // Setup
+    auto frames = vector<int> { 30, 10, 20, 10 };
+    auto sampler = ListSampler(frames);
+
+    // Execute
+    auto first = sampler.GetFrame(0); auto past = sampler.GetFrame(3);
+    auto probe = sampler.GetFirstProbe(11); auto closest = sampler.GetProbe(24);
+    auto gap = sampler.GetMinGap();
+
+    // Confirm
+    ASSERT_EQ(first, 10);
+    ASSERT_EQ(past, INT_MAX);
+    ASSERT_EQ(probe, 1);
+    ASSERT_EQ(closest, 1);
+    ASSERT_EQ(gap, 10);
+}
+
+/**
+ * @brief Confirm that the step sampler matches the original frame step numbering
+ */
+TEST(FrameIndex_Test, step_sampler)
+{
+    // Setup
+    auto sampler = StepSampler(5);
+
+    // Execute
+    auto frame = sampler.GetFrame(3); auto probe = sampler.GetFirstProbe(11); auto closest = sampler.GetProbe(12);
+
+    // Confirm
+    ASSERT_EQ(frame, 15);
+    ASSERT_EQ(probe, 3);
+    ASSERT_EQ(closest, 2);
+}
@@ -0,0 +1,106 @@
+//--------------------------------------------------
+// Unit Tests for resuming an extraction from its manifest
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <climits>
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/FrameManifest.h>
+#include <VidExtractLib/ArchiveSink.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Function Prototypes
+//--------------------------------------------------
+void WriteFrame(FrameSink * sink, FrameManifest& manifest, int index, const string& data);
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the manifest is read back only when the settings match
+ */
+TEST(FrameManifest_Test, settings_match) 
+{
+    // Setup
+    auto path = string("FrameManifest_Settings.manifest");
+    auto ranges = vector<Vec2i> { Vec2i(0, 100), Vec2i(100, INT_MAX) };
+    auto entries = vector<ManifestEntry> { ManifestEntry(1, 10, 100, "image_0010.jpg", 0xCBF43926u, 9, 0, 4000.0) };
+
+    // Execute
+    auto writer = FrameManifest(path, "quality=95"); writer.Start(ranges, entries);
+    writer.MarkComplete();
+
+    auto same = FrameManifest(path, "quality=95"); auto sameLoaded = same.Load();
+    auto other = FrameManifest(path, "quality=90"); auto otherLoaded = other.Load();
+    remove(path.c_str());
+
+    // Confirm
+    ASSERT_TRUE(sameLoaded);
+    ASSERT_FALSE(otherLoaded);
+    ASSERT_TRUE(same.IsComplete());
+    ASSERT_EQ(same.GetRanges().size(), 2u);
+    ASSERT_EQ(same.GetEntries().size(), 1u);
+    ASSERT_EQ(same.GetEntries()[0].GetCrc(), 0xCBF43926u);
+    ASSERT_EQ(same.GetEntries()[0].GetFrame(), 100);
+    ASSERT_EQ(same.GetEntries()[0].GetTimestamp(), 4000.0);
+}
+
+/**
+ * @brief Confirm that a frame cut short by a crash is dropped and the archive continues after the intact ones
+ */
+TEST(FrameManifest_Test, resume_archive) 
+{
+    // Setup
+    auto archivePath = string("FrameManifest_Resume.zip"); auto manifestPath = string("FrameManifest_Resume.manifest");
+    auto ranges = vector<Vec2i> { Vec2i(0, INT_MAX) }; auto entries = vector<ManifestEntry>();
+
+    auto manifest = FrameManifest(manifestPath, "test"); manifest.Start(ranges, entries);
+    auto sink = new ArchiveSink(archivePath);
+    WriteFrame(sink, manifest, 0, "frame zero"); WriteFrame(sink, manifest, 1, "frame one"); WriteFrame(sink, manifest, 2, "frame two");
+    delete sink;
+
+    auto size = filesystem::file_size(archivePath); filesystem::resize_file(archivePath, size - 3);
+
+    // Execute
+    auto reloaded = FrameManifest(manifestPath, "test"); reloaded.Load();
+    auto kept = reloaded.GetEntries();
+    auto resumed = new ArchiveSink(archivePath, kept);
+    reloaded.Start(ranges, kept);
+    WriteFrame(resumed, reloaded, 2, "frame two"); resumed->Close();
+    delete resumed;
+
+    auto archiveSize = filesystem::file_size(archivePath); auto count = reloaded.GetEntries().size();
+    remove(archivePath.c_str()); remove(manifestPath.c_str());
+
+    // Confirm
+    ASSERT_EQ(kept.size(), 2u);
+    ASSERT_EQ(count, 3u);
+    ASSERT_EQ(archiveSize, size + 3 * (46u + 14u) + 22u);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Pass a frame through the sink and record it, as the manifest sink does
+ * @param sink The sink that we are writing to
+ * @param manifest The manifest that records the frame
+ * @param index The index of the frame
+ * @param data The content of the frame
+ */
+void WriteFrame(FrameSink * sink, FrameManifest& manifest, int index, const string& data) 
+{
+    Mat image; auto packet = FramePacket(0, index, index * 10, image);
+    packet.GetBuffer().assign(data.begin(), data.end());
+    packet.GetCrc() = ZipWriter::GetCrc32(packet.GetBuffer().data(), packet.GetBuffer().size());
+
+    sink->Write(&packet);
+    manifest.Append(&packet, FolderSink::GetFileName(index));
+}
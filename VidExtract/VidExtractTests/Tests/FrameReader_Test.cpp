@@ -0,0 +1,132 @@
+//--------------------------------------------------
+// Unit Tests for reading frames by number
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/FrameReader.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Write a short MJPG video at 25 fps in which frame i is filled with the value 10 * i
+ * @param path The path of the video that we are writing
+ * @param count The number of frames in the video
+ */
+static void WriteVideo(const string& path, int count)
+{
+    auto writer = VideoWriter(path, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25, Size(64, 48));
+    for (auto i = 0; i < count; i++)
+    {
+        auto image = Mat(48, 64, CV_8UC3, Scalar::all(i * 10)); writer.write(image);
+    }
+    writer.release();
+}
+
+/**
+ * @brief Build an index of the frames of the test video with keyframes at 0 and 6
+ * @param count The number of frames in the video
+ * @return FrameIndex * The resultant index
+ */
+static FrameIndex * BuildIndex(int count)
+{
+    auto timestamps = vector<double>(); auto keyframes = vector<uint8_t>(); auto sizes = vector<uint64_t>();
+    for (auto i = 0; i < count; i++)
+    {
+        timestamps.push_back(i * 40.0); keyframes.push_back(i == 6 ? 1 : 0); sizes.push_back(i == 6 ? 1000 : 100);
+    }
+    return new FrameIndex(timestamps, keyframes, sizes);
+}
+
+/**
+ * @brief Find the number of a frame of the test video from its content
+ * @param image The image that was read
+ * @return int The frame number
+ */
+static int GetFrameNumber(Mat& image)
+{
+    return (int)round(mean(image)[0] / 10.0);
+}
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a frame that an indexed seek lands on exactly is the frame that is returned
+ */
+TEST(FrameReader_Test, read_keyframe)
+{
+    // Setup
+    auto path = string("FrameReader_Test_keyframe.avi"); WriteVideo(path, 10);
+    auto index = BuildIndex(10);
+    auto reader = new FrameReader(path, 0); reader->SetIndex(index);
+
+    // Execute
+    Mat keyframe; auto first = reader->Read(6, keyframe);
+    Mat next; auto second = reader->Read(7, next);
+    delete reader; delete index;
+    remove(path.c_str());
+
+    // Confirm
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    ASSERT_EQ(GetFrameNumber(keyframe), 6);
+    ASSERT_EQ(GetFrameNumber(next), 7);
+}
+
+/**
+ * @brief Confirm that the first read seeks to a frame part way in, even when the reader only grabs
+ */
+TEST(FrameReader_Test, first_read_seeks)
+{
+    // Setup
+    auto path = string("FrameReader_Test_first.avi"); WriteVideo(path, 10);
+    auto reader = new FrameReader(path, INT_MAX);
+
+    // Execute
+    Mat image; auto success = reader->Read(7, image);
+    auto seeks = reader->GetSeekCount();
+    delete reader;
+    remove(path.c_str());
+
+    // Confirm
+    ASSERT_TRUE(success);
+    ASSERT_EQ(seeks, 1);
+    ASSERT_EQ(GetFrameNumber(image), 7);
+}
+
+/**
+ * @brief Confirm that the frames read after forward and backward seeks are the frames that were asked for
+ */
+TEST(FrameReader_Test, read_after_seek)
+{
+    // Setup
+    auto path = string("FrameReader_Test_seek.avi"); WriteVideo(path, 10);
+    auto reader = new FrameReader(path, 2);
+
+    // Execute
+    Mat first; reader->Read(1, first);
+    Mat forward; reader->Read(8, forward);
+    Mat backward; reader->Read(3, backward);
+    Mat next; reader->Read(4, next);
+    Mat past; auto end = reader->Read(12, past);
+    auto seeks = reader->GetSeekCount();
+    delete reader;
+    remove(path.c_str());
+
+    // Confirm
+    ASSERT_EQ(GetFrameNumber(first), 1);
+    ASSERT_EQ(GetFrameNumber(forward), 8);
+    ASSERT_EQ(GetFrameNumber(backward), 3);
+    ASSERT_EQ(GetFrameNumber(next), 4);
+    ASSERT_FALSE(end);
+    ASSERT_EQ(seeks, 4);
+}
@@ -0,0 +1,63 @@
+//--------------------------------------------------
+// Unit Tests for the packed frame container
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/PackWriter.h>
+#include <VidExtractLib/PackReader.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that frames written out of order are read back by index
+ */
+TEST(PackWriter_Test, round_trip) 
+{
+    // Setup
+    auto path = string("PackWriter_Test.vxp");
+    auto frame0 = string("frame zero"); auto frame1 = string("frame one!!");
+
+    // Execute
+    auto writer = PackWriter(path);
+    writer.Add(1, 20, 800.0, (const unsigned char *) frame1.c_str(), frame1.size());
+    writer.Add(0, 0, 0.0, (const unsigned char *) frame0.c_str(), frame0.size());
+    writer.Close();
+
+    auto reader = new PackReader(path);
+    auto count = reader->GetCount();
+    auto entry = reader->GetEntry(1);
+    size_t size0; auto data0 = reader->GetData(0, size0);
+    size_t size1; auto data1 = reader->GetData(1, size1);
+    auto text0 = string((const char *) data0, size0); auto text1 = string((const char *) data1, size1);
+    delete reader; remove(path.c_str());
+
+    // Confirm
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(entry.GetIndex(), 1u);
+    ASSERT_EQ(entry.GetFrame(), 20u);
+    ASSERT_EQ(entry.GetTimestamp(), 800.0);
+    ASSERT_EQ(text0, frame0);
+    ASSERT_EQ(text1, frame1);
+}
+
+/**
+ * @brief Confirm that a container that was never closed is rejected
+ */
+TEST(PackWriter_Test, unfinished_container) 
+{
+    // Setup
+    auto path = string("PackWriter_Unfinished.vxp");
+    auto writer = ofstream(path, ios::binary); writer << string(64, '\0'); writer.close();
+
+    // Execute and Confirm
+    ASSERT_THROW(PackReader reader(path), runtime_error);
+    remove(path.c_str());
+}
@@ -0,0 +1,114 @@
+//--------------------------------------------------
+// Unit Tests for selecting frames by parallax
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/ParallaxSelector.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief A smooth non-repeating texture (value noise on a 6 pixel lattice, with smoothstep blending)
+ * @param x The x coordinate that we are sampling
+ * @param y The y coordinate that we are sampling
+ * @return double The intensity at the point
+ */
+static double GetTexture(double x, double y)
+{
+    auto lattice = [](int u, int v) { auto hash = (uint32_t)(u * 73856093) ^ (uint32_t)(v * 19349663); hash = (hash ^ (hash >> 13)) * 0x5bd1e995u; return (double)((hash ^ (hash >> 15)) & 0xFF); };
+    auto smooth = [](double t) { return t * t * (3 - 2 * t); };
+
+    auto u = x / 6.0, v = y / 6.0; auto u0 = (int)floor(u), v0 = (int)floor(v); auto au = smooth(u - u0), av = smooth(v - v0);
+    return (1 - av) * ((1 - au) * lattice(u0, v0) + au * lattice(u0 + 1, v0)) + av * ((1 - au) * lattice(u0, v0 + 1) + au * lattice(u0 + 1, v0 + 1));
+}
+
+/**
+ * @brief Render a frame of a camera panning sideways across the texture
+ * @param shift The horizontal translation of the frame (in pixels)
+ * @return Mat The resultant 64x48 colour frame
+ */
+static Mat Render(double shift)
+{
+    auto result = Mat(48, 64, CV_8UC3);
+    for (auto row = 0; row < result.rows; row++) for (auto column = 0; column < result.cols; column++)
+    {
+        auto value = (uchar)round(GetTexture(column + shift + 100, row + 100)); result.at<Vec3b>(row, column) = Vec3b(value, value, value);
+    }
+    return result;
+}
+
+/**
+ * @brief Find the frames of a pan that a selector keeps
+ * @param selector The selector that is being tested
+ * @param step The shift between neighbouring frames (in pixels)
+ * @param count The number of frames in the pan
+ * @return vector<int> The numbers of the frames that were kept
+ */
+static vector<int> GetKept(ParallaxSelector& selector, double step, int count)
+{
+    auto result = vector<int>();
+    for (auto i = 0; i < count; i++)
+    {
+        auto frame = Render(step * i);
+        if (selector.Accept(frame)) result.push_back(i);
+    }
+    return result;
+}
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a frame is kept once the shift accumulated since the last kept frame reaches the threshold
+ * @remarks The threshold is 0.1 of a 64 pixel width (6.4 pixels), so with 2 pixels a frame every fourth frame is kept.
+ */
+TEST(ParallaxSelector_Test, keep_on_parallax)
+{
+    // Setup
+    auto selector = ParallaxSelector(0.1, 64);
+
+    // Execute
+    auto kept = GetKept(selector, 2.0, 13);
+
+    // Confirm
+    ASSERT_EQ(kept, vector<int>({ 0, 4, 8, 12 }));
+}
+
+/**
+ * @brief Confirm that a larger threshold keeps fewer frames, and that the count restarts after each kept frame
+ */
+TEST(ParallaxSelector_Test, threshold_resets)
+{
+    // Setup
+    auto selector = ParallaxSelector(0.2, 64);
+
+    // Execute
+    auto kept = GetKept(selector, 2.0, 15);
+
+    // Confirm
+    ASSERT_EQ(kept, vector<int>({ 0, 7, 14 }));
+}
+
+/**
+ * @brief Confirm that a camera that does not move only keeps the first frame
+ */
+TEST(ParallaxSelector_Test, static_scene)
+{
+    // Setup
+    auto selector = ParallaxSelector(0.05, 64);
+
+    // Execute
+    auto kept = GetKept(selector, 0.0, 10);
+
+    // Confirm
+    ASSERT_EQ(kept, vector<int>({ 0 }));
+}
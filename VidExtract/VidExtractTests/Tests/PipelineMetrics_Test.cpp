@@ -0,0 +1,138 @@
+//--------------------------------------------------
+// Unit Tests for the pipeline metrics reports
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <map>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/PipelineMetrics.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Parse a report, which must be a single-line JSON object of numbers
+ * @param line The report
+ * @param fields The value of each field
+ * @return true If the report is well formed
+ * @return false If the report is not a flat single-line JSON object of numbers
+ */
+static bool ParseReport(const string& line, map<string, double>& fields)
+{
+    if (line.size() < 2 || line.front() != '{' || line.back() != '}' || line.find('\n') != string::npos) return false;
+
+    auto position = size_t(1);
+    while (position < line.size() - 1)
+    {
+        if (line[position] != '"') return false;
+        auto end = line.find('"', position + 1); if (end == string::npos || end + 1 >= line.size() || line[end + 1] != ':') return false;
+        auto name = line.substr(position + 1, end - position - 1);
+
+        auto valueEnd = line.find_first_of(",}", end + 2); auto value = line.substr(end + 2, valueEnd - end - 2);
+        auto parsed = size_t(0); try { fields[name] = stod(value, &parsed); } catch (exception&) { return false; }
+        if (parsed != value.size()) return false;
+
+        position = valueEnd + (line[valueEnd] == ',' ? 1 : 0);
+    }
+    return true;
+}
+
+/**
+ * @brief Add a number of counts to the metrics
+ * @param metrics The metrics that are updated
+ * @param probes The number of sampling points that were read
+ * @param decoded The number of frames that were decoded
+ * @param encoded The number of frames that were encoded
+ * @param written The number of frames that were written (of 1000 bytes each)
+ */
+static void AddCounts(PipelineMetrics& metrics, int probes, int decoded, int encoded, int written)
+{
+    for (auto i = 0; i < probes; i++) metrics.AddProbe();
+    for (auto i = 0; i < decoded; i++) metrics.AddDecoded();
+    for (auto i = 0; i < encoded; i++) metrics.AddEncoded();
+    for (auto i = 0; i < written; i++) metrics.AddWritten(1000);
+}
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a progress line carries the queue depths, counts, seeks, interval rates and the estimate
+ */
+TEST(PipelineMetrics_Test, progress_fields)
+{
+    // Setup
+    auto metrics = PipelineMetrics(); metrics.SetExpectedProbes(100);
+    AddCounts(metrics, 25, 40, 30, 20);
+    this_thread::sleep_for(chrono::milliseconds(200));
+
+    // Execute
+    auto first = map<string, double>(); auto firstValid = ParseReport(metrics.GetProgress(7, 3, 4), first);
+    AddCounts(metrics, 25, 10, 10, 10);
+    this_thread::sleep_for(chrono::milliseconds(200));
+    auto second = map<string, double>(); auto secondValid = ParseReport(metrics.GetProgress(1, 0, 6), second);
+
+    // Confirm
+    ASSERT_TRUE(firstValid);
+    ASSERT_EQ(first["decode_queue"], 7); ASSERT_EQ(first["reorder_queue"], 3);
+    ASSERT_EQ(first["probed"], 25); ASSERT_EQ(first["written"], 20); ASSERT_EQ(first["bytes"], 20000); ASSERT_EQ(first["seeks"], 4);
+    ASSERT_NEAR(first["decode_fps"], 40 / first["elapsed_s"], 0.05 * first["decode_fps"] + 0.01);
+    ASSERT_NEAR(first["encode_fps"], 30 / first["elapsed_s"], 0.05 * first["encode_fps"] + 0.01);
+    ASSERT_NEAR(first["eta_s"], 3 * first["elapsed_s"], 0.03);
+
+    ASSERT_TRUE(secondValid);
+    ASSERT_EQ(second["probed"], 50); ASSERT_EQ(second["written"], 30); ASSERT_EQ(second["bytes"], 30000); ASSERT_EQ(second["seeks"], 6);
+    auto interval = second["elapsed_s"] - first["elapsed_s"];
+    ASSERT_NEAR(second["decode_fps"], 10 / interval, 0.1 * second["decode_fps"]);
+    ASSERT_NEAR(second["eta_s"], second["elapsed_s"], 0.03);
+}
+
+/**
+ * @brief Confirm that the estimate is withheld until there is something to go on
+ */
+TEST(PipelineMetrics_Test, progress_without_estimate)
+{
+    // Setup
+    auto metrics = PipelineMetrics();
+    AddCounts(metrics, 5, 5, 5, 5);
+
+    // Execute
+    auto fields = map<string, double>(); auto valid = ParseReport(metrics.GetProgress(0, 0, 0), fields);
+
+    // Confirm
+    ASSERT_TRUE(valid);
+    ASSERT_EQ(fields["eta_s"], -1);
+}
+
+/**
+ * @brief Confirm that the summary is one line of JSON with the totals of the run
+ */
+TEST(PipelineMetrics_Test, summary_json)
+{
+    // Setup
+    auto metrics = PipelineMetrics(); metrics.SetExpectedProbes(10);
+    AddCounts(metrics, 10, 12, 10, 10);
+    this_thread::sleep_for(chrono::milliseconds(50));
+
+    // Execute
+    auto summary = metrics.GetSummary(2);
+    auto fields = map<string, double>(); auto valid = ParseReport(summary, fields);
+
+    // Confirm
+    ASSERT_TRUE(valid);
+    ASSERT_EQ(fields.size(), 10u);
+    ASSERT_EQ(fields["probed"], 10); ASSERT_EQ(fields["decoded"], 12); ASSERT_EQ(fields["encoded"], 10);
+    ASSERT_EQ(fields["written"], 10); ASSERT_EQ(fields["bytes"], 10000); ASSERT_EQ(fields["seeks"], 2);
+    ASSERT_GT(fields["elapsed_s"], 0);
+    ASSERT_NEAR(fields["decode_fps"], 12 / fields["elapsed_s"], 0.05 * fields["decode_fps"] + 0.01);
+    ASSERT_NEAR(fields["write_mb_s"], 10000 / fields["elapsed_s"] / (1024.0 * 1024.0), 0.01);
+}
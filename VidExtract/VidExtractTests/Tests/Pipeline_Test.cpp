@@ -0,0 +1,174 @@
+//--------------------------------------------------
+// Unit Tests for decoding and writing a video in segments
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/Pipeline.h>
+#include <VidExtractLib/StepSampler.h>
+#include <VidExtractLib/FolderSink.h>
+#include <VidExtractLib/SharpnessSelector.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief A sink that records the name and source frame of each frame that it is given, and the order of the writes
+ */
+class RecordSink : public FrameSink
+{
+private:
+    map<string, int> _frames;
+    vector<pair<int, int>> _writes;
+public:
+    virtual void Write(FramePacket * packet) override 
+    { 
+        _frames[FolderSink::GetFileName(packet->GetIndex())] = packet->GetFrame(); 
+        _writes.push_back(make_pair(packet->GetSegment(), packet->GetIndex()));
+    }
+    virtual bool IsEncoded() override { return false; }
+    inline map<string, int>& GetFrames() { return _frames; }
+    inline vector<pair<int, int>>& GetWrites() { return _writes; }
+};
+
+/**
+ * @brief Write a short MJPG video in which every third frame is flat (and so fails a sharpness check)
+ * @param path The path of the video that we are writing
+ * @param count The number of frames in the video
+ */
+static void WriteVideo(const string& path, int count)
+{
+    auto writer = VideoWriter(path, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25, Size(64, 48));
+    for (auto i = 0; i < count; i++)
+    {
+        auto image = Mat(48, 64, CV_8UC3, Scalar::all(128));
+        if (i % 3 != 0) for (auto row = 0; row < image.rows; row++) for (auto column = 0; column < image.cols; column++)
+        {
+            if ((row / 4 + column / 4) % 2 == 0) image.at<Vec3b>(row, column) = Vec3b(255, 255, 255);
+        }
+        writer.write(image);
+    }
+    writer.release();
+}
+
+/**
+ * @brief Extract the frames of a video the way the module does, splitting it into segments
+ * @param path The path of the video
+ * @param frameStep The number of frames between extracted frames
+ * @param count The number of segments that we want (one is used when a selector is sequential)
+ * @param selectors The selectors that are applied to the decoded frames
+ * @param frames The names of the frames that were written, with the source frame of each
+ * @param writes The segment and output index of each write, in the order that they reached the sink
+ * @param window The frames either side of a sampling point searched for the sharpest (0 for none)
+ */
+static void Extract(const string& path, int frameStep, int count, vector<FrameSelector *>& selectors, map<string, int>& frames, vector<pair<int, int>>& writes, int window = 0)
+{
+    for (auto selector : selectors) if (selector->IsSequential()) count = 1;
+
+    auto sampler = StepSampler(frameStep); auto sink = RecordSink();
+    auto ranges = vector<Vec2i>(); Segment::Plan(30, frameStep, 1, nullptr, count, ranges);
+
+    auto segments = vector<Segment *>();
+    for (auto i = 0; i < (int)ranges.size(); i++)
+    {
+        segments.push_back(new Segment(i, new FrameReader(path, 4), ranges[i][0], ranges[i][1], sampler.GetFirstProbe(ranges[i][0])));
+    }
+
+    auto pipeline = Pipeline(segments, &sink, selectors, &sampler, 90, 2, 4);
+    pipeline.SetWindow(window, 64); pipeline.Run();
+    for (auto segment : segments) delete segment;
+
+    frames = sink.GetFrames(); writes = sink.GetWrites();
+}
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that a video split into segments is written under the same names as a single pass
+ */
+TEST(Pipeline_Test, segment_names)
+{
+    // Setup
+    auto path = string("Pipeline_Test_names.avi"); WriteVideo(path, 30);
+    auto selectors = vector<FrameSelector *>();
+
+    // Execute
+    auto writes = vector<pair<int, int>>();
+    auto single = map<string, int>(); Extract(path, 2, 1, selectors, single, writes);
+    auto split = map<string, int>(); Extract(path, 2, 3, selectors, split, writes);
+    remove(path.c_str());
+
+    // Confirm
+    ASSERT_EQ(single.size(), 15u);
+    ASSERT_EQ(split, single);
+}
+
+/**
+ * @brief Confirm that dropping blurred frames names the output the same way however many segments are asked for
+ */
+TEST(Pipeline_Test, reject_names)
+{
+    // Setup
+    auto path = string("Pipeline_Test_reject.avi"); WriteVideo(path, 30);
+    auto selector = SharpnessSelector(100, 64); auto selectors = vector<FrameSelector *> { &selector };
+
+    // Execute
+    auto writes = vector<pair<int, int>>();
+    auto single = map<string, int>(); Extract(path, 1, 1, selectors, single, writes);
+    auto split = map<string, int>(); Extract(path, 1, 3, selectors, split, writes);
+    remove(path.c_str());
+
+    // Confirm
+    ASSERT_EQ(single.size(), 20u);
+    ASSERT_EQ(single["image_0000.jpg"], 1);
+    ASSERT_EQ(split, single);
+}
+
+/**
+ * @brief Confirm that the sharpness window names the output the same way when the video is split into segments
+ */
+TEST(Pipeline_Test, window_names)
+{
+    // Setup
+    auto path = string("Pipeline_Test_window.avi"); WriteVideo(path, 30);
+    auto selectors = vector<FrameSelector *>();
+
+    // Execute
+    auto writes = vector<pair<int, int>>();
+    auto single = map<string, int>(); Extract(path, 3, 1, selectors, single, writes, 1);
+    auto split = map<string, int>(); Extract(path, 3, 3, selectors, split, writes, 1);
+    remove(path.c_str());
+
+    // Confirm
+    ASSERT_EQ(single.size(), 10u);
+    ASSERT_EQ(single["image_0000.jpg"], 1);
+    ASSERT_EQ(split, single);
+}
+
+/**
+ * @brief Confirm that each segment reaches the sink in index order while the encoders finish out of order
+ */
+TEST(Pipeline_Test, ordered_writes)
+{
+    // Setup
+    auto path = string("Pipeline_Test_order.avi"); WriteVideo(path, 30);
+    auto selectors = vector<FrameSelector *>();
+
+    // Execute
+    auto frames = map<string, int>(); auto writes = vector<pair<int, int>>();
+    Extract(path, 1, 3, selectors, frames, writes);
+    remove(path.c_str());
+
+    // Confirm
+    ASSERT_EQ(writes.size(), 30u);
+    auto next = map<int, int> { { 0, 0 }, { 1, 10 }, { 2, 20 } };
+    for (auto& write : writes) ASSERT_EQ(write.second, next[write.first]++);
+}
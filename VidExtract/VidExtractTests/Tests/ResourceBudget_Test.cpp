@@ -0,0 +1,89 @@
+//--------------------------------------------------
+// Unit Tests for the shared thread and writer budget
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/ResourceBudget.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that no more tokens are held at once than the pool was given, however many threads ask
+ */
+TEST(ResourceBudget_Test, bounded_under_contention)
+{
+    // Setup
+    auto pool = TokenPool(); pool.Configure(3);
+    auto active = atomic<int>(0); auto peak = atomic<int>(0); auto completed = atomic<int>(0);
+
+    // Execute
+    auto workers = vector<thread>();
+    for (auto i = 0; i < 12; i++) workers.push_back(thread([&]
+    {
+        for (auto j = 0; j < 20; j++)
+        {
+            auto guard = TokenGuard(pool);
+            auto count = ++active; auto best = peak.load();
+            while (count > best && !peak.compare_exchange_weak(best, count)) {}
+            this_thread::sleep_for(chrono::microseconds(200));
+            active--; completed++;
+        }
+    }));
+    for (auto& worker : workers) worker.join();
+
+    // Confirm
+    ASSERT_EQ(completed.load(), 240);
+    ASSERT_LE(peak.load(), 3);
+    ASSERT_GE(peak.load(), 1);
+}
+
+/**
+ * @brief Confirm that a guard gives its token back when the work that holds it throws
+ */
+TEST(ResourceBudget_Test, guard_releases_on_exception)
+{
+    // Setup
+    auto pool = TokenPool(); pool.Configure(1);
+
+    // Execute
+    auto thrown = false;
+    try { auto guard = TokenGuard(pool); throw runtime_error("Encoding failed"); }
+    catch (runtime_error&) { thrown = true; }
+
+    auto next = async(launch::async, [&pool] { auto guard = TokenGuard(pool); return true; });
+    auto status = next.wait_for(chrono::seconds(5));
+
+    // Confirm
+    ASSERT_TRUE(thrown);
+    ASSERT_EQ(status, future_status::ready);
+    ASSERT_TRUE(next.get());
+}
+
+/**
+ * @brief Confirm that a pool with no tokens configured never blocks
+ */
+TEST(ResourceBudget_Test, unlimited_pool)
+{
+    // Setup
+    auto pool = TokenPool(); pool.Configure(0);
+
+    // Execute
+    for (auto i = 0; i < 10; i++) pool.Acquire();
+    for (auto i = 0; i < 10; i++) pool.Release();
+
+    // Confirm
+    auto guard = TokenGuard(pool);
+    SUCCEED();
+}
@@ -0,0 +1,68 @@
+//--------------------------------------------------
+// Unit Tests for splitting a video into segments
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/Segment.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the boundaries fall on the keyframes of the index rather than on multiples of the GOP size
+ */
+TEST(Segment_Test, plan_on_keyframes)
+{
+    // Setup
+    auto timestamps = vector<double>(); auto keyframes = vector<uint8_t>(); auto sizes = vector<uint64_t>();
+    for (auto i = 0; i < 100; i++)
+    {
+        timestamps.push_back(i * 40.0); keyframes.push_back(i == 31 || i == 62 ? 1 : 0); sizes.push_back(100);
+    }
+    auto index = FrameIndex(timestamps, keyframes, sizes);
+
+    // Execute
+    auto ranges = vector<Vec2i>(); Segment::Plan(100, 1, 25, &index, 3, ranges);
+
+    // Confirm
+    ASSERT_EQ(ranges.size(), 3u);
+    ASSERT_EQ(ranges[0], Vec2i(0, 31));
+    ASSERT_EQ(ranges[1], Vec2i(31, 62));
+    ASSERT_EQ(ranges[2], Vec2i(62, INT_MAX));
+}
+
+/**
+ * @brief Confirm that without an index the boundaries are rounded to the GOP size and then up to the frame step
+ */
+TEST(Segment_Test, plan_on_gop)
+{
+    // Execute
+    auto ranges = vector<Vec2i>(); Segment::Plan(100, 5, 12, nullptr, 4, ranges);
+
+    // Confirm
+    ASSERT_EQ(ranges.size(), 4u);
+    ASSERT_EQ(ranges[0], Vec2i(0, 25));
+    ASSERT_EQ(ranges[1], Vec2i(25, 50));
+    ASSERT_EQ(ranges[2], Vec2i(50, 75));
+    ASSERT_EQ(ranges[3], Vec2i(75, INT_MAX));
+}
+
+/**
+ * @brief Confirm that boundaries that collapse onto the same keyframe are dropped
+ */
+TEST(Segment_Test, plan_short_video)
+{
+    // Execute
+    auto ranges = vector<Vec2i>(); Segment::Plan(10, 1, 30, nullptr, 4, ranges);
+
+    // Confirm
+    ASSERT_EQ(ranges.size(), 1u);
+    ASSERT_EQ(ranges[0], Vec2i(0, INT_MAX));
+}
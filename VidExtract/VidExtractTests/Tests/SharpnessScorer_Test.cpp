@@ -0,0 +1,81 @@
+//--------------------------------------------------
+// Unit Tests for scoring the sharpness of a frame
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/SharpnessScorer.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Helpers
+//--------------------------------------------------
+
+/**
+ * @brief Find the variance of the 4-neighbour Laplacian over the interior of an image, one pixel at a time
+ * @param gray The 8-bit gray image
+ * @return double The resultant variance
+ */
+static double GetExpectedScore(Mat& gray)
+{
+    auto sum = 0.0, squares = 0.0;
+    for (auto row = 1; row < gray.rows - 1; row++) for (auto column = 1; column < gray.cols - 1; column++)
+    {
+        auto laplacian = 4.0 * gray.at<uchar>(row, column) - gray.at<uchar>(row, column - 1) - gray.at<uchar>(row, column + 1) - gray.at<uchar>(row - 1, column) - gray.at<uchar>(row + 1, column);
+        sum += laplacian; squares += laplacian * laplacian;
+    }
+
+    auto count = (double)(gray.rows - 2) * (gray.cols - 2);
+    auto mean = sum / count;
+    return squares / count - mean * mean;
+}
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the vectorized rows and the scalar remainder give the per-pixel result
+ */
+TEST(SharpnessScorer_Test, matches_per_pixel)
+{
+    // Setup
+    auto gray = Mat(37, 53, CV_8UC1); auto random = RNG(7);
+    for (auto row = 0; row < gray.rows; row++) for (auto column = 0; column < gray.cols; column++) gray.at<uchar>(row, column) = (uchar)random.uniform(0, 256);
+
+    // Execute
+    auto score = SharpnessScorer::GetScore(gray);
+    auto expected = GetExpectedScore(gray);
+
+    // Confirm
+    ASSERT_NEAR(score, expected, 1e-6 * expected);
+}
+
+/**
+ * @brief Confirm that a flat frame scores zero and that a blurred frame scores below the original
+ */
+TEST(SharpnessScorer_Test, blur_lowers_score)
+{
+    // Setup
+    auto flat = Mat(48, 64, CV_8UC3, Scalar::all(90));
+    auto sharp = Mat(48, 64, CV_8UC3, Scalar::all(0));
+    for (auto row = 0; row < sharp.rows; row++) for (auto column = 0; column < sharp.cols; column++)
+    {
+        if ((row / 8 + column / 8) % 2 == 0) sharp.at<Vec3b>(row, column) = Vec3b(255, 255, 255);
+    }
+    Mat blurred; resize(sharp, blurred, Size(16, 12), 0, 0, INTER_AREA); resize(blurred, blurred, sharp.size(), 0, 0, INTER_LINEAR);
+
+    // Execute
+    auto flatScore = SharpnessScorer::GetScore(flat, 64);
+    auto sharpScore = SharpnessScorer::GetScore(sharp, 64);
+    auto blurredScore = SharpnessScorer::GetScore(blurred, 64);
+
+    // Confirm
+    ASSERT_EQ(flatScore, 0);
+    ASSERT_GT(blurredScore, 0);
+    ASSERT_LT(blurredScore, sharpScore);
+}
@@ -0,0 +1,49 @@
+//--------------------------------------------------
+// Unit Tests for the frame stream output
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/StreamSink.h>
+#include <VidExtractLib/StreamReader.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the frame headers and payloads are read back as they were written
+ */
+TEST(StreamSink_Test, round_trip) 
+{
+    // Setup
+    auto path = string("StreamSink_Test.stream");
+    auto data = string("jpeg data");
+    Mat image; auto packet = FramePacket(0, 7, 70, image);
+    packet.GetBuffer().assign(data.begin(), data.end());
+
+    // Execute
+    packet.GetTimestamp() = 2800.0;
+    auto sink = StreamSink(path, STREAM_FORMAT_JPEG);
+    sink.Write(&packet); sink.Write(&packet);
+    sink.Close();
+
+    auto reader = StreamReader(path); auto frame = StreamFrame();
+    auto first = reader.Read(frame); auto second = reader.Read(frame); auto third = reader.Read(frame);
+    remove(path.c_str());
+
+    // Confirm
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    ASSERT_FALSE(third);
+    ASSERT_EQ(frame.GetFormat(), STREAM_FORMAT_JPEG);
+    ASSERT_EQ(frame.GetIndex(), 7);
+    ASSERT_EQ(frame.GetFrame(), 70);
+    ASSERT_EQ(frame.GetTimestamp(), 2800.0);
+    ASSERT_EQ(string(frame.GetPayload().begin(), frame.GetPayload().end()), data);
+}
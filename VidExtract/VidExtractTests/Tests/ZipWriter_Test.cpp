@@ -0,0 +1,94 @@
+//--------------------------------------------------
+// Unit Tests for the streaming zip writer
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <VidExtractLib/ZipWriter.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Function Prototypes
+//--------------------------------------------------
+uint32_t Read32(const vector<char>& bytes, size_t offset);
+uint16_t Read16(const vector<char>& bytes, size_t offset);
+
+//--------------------------------------------------
+// Unit Tests
+//--------------------------------------------------
+
+/**
+ * @brief Confirm that the checksum matches the standard CRC-32 check value
+ */
+TEST(ZipWriter_Test, crc_check_value) 
+{
+    // Setup
+    auto data = string("123456789");
+
+    // Execute
+    auto crc = ZipWriter::GetCrc32((const unsigned char *) data.c_str(), data.size());
+
+    // Confirm
+    ASSERT_EQ(crc, 0xCBF43926u);
+}
+
+/**
+ * @brief Confirm that the entries and the central directory are laid out correctly
+ */
+TEST(ZipWriter_Test, archive_layout) 
+{
+    // Setup
+    auto path = string("ZipWriter_Test.zip");
+    auto data = string("frame data");
+
+    // Execute
+    auto writer = ZipWriter(path);
+    auto offset1 = writer.Add("image_0000.jpg", (const unsigned char *) data.c_str(), data.size());
+    auto offset2 = writer.Add("image_0001.jpg", (const unsigned char *) data.c_str(), data.size());
+    writer.Close();
+
+    auto reader = ifstream(path, ios::binary);
+    auto bytes = vector<char>(istreambuf_iterator<char>(reader), istreambuf_iterator<char>());
+    reader.close(); remove(path.c_str());
+
+    // Confirm
+    ASSERT_EQ(offset1, 0u);
+    ASSERT_EQ(offset2, 30u + 14u + data.size());
+    ASSERT_EQ(Read32(bytes, 0), 0x04034b50u);
+    ASSERT_EQ(Read32(bytes, offset2), 0x04034b50u);
+
+    auto end = bytes.size() - 22;
+    ASSERT_EQ(Read32(bytes, end), 0x06054b50u);
+    ASSERT_EQ(Read16(bytes, end + 10), 2);
+    ASSERT_EQ(Read32(bytes, Read32(bytes, end + 16)), 0x02014b50u);
+}
+
+//--------------------------------------------------
+// Helper Methods
+//--------------------------------------------------
+
+/**
+ * @brief Read a little-endian 32-bit value
+ * @param bytes The bytes that we are reading from
+ * @param offset The offset of the value
+ * @return uint32_t The resultant value
+ */
+uint32_t Read32(const vector<char>& bytes, size_t offset) 
+{
+    return (uint32_t)Read16(bytes, offset) | ((uint32_t)Read16(bytes, offset + 2) << 16);
+}
+
+/**
+ * @brief Read a little-endian 16-bit value
+ * @param bytes The bytes that we are reading from
+ * @param offset The offset of the value
+ * @return uint16_t The resultant value
+ */
+uint16_t Read16(const vector<char>& bytes, size_t offset) 
+{
+    return (uint16_t)((unsigned char)bytes[offset] | ((unsigned char)bytes[offset + 1] << 8));
+}
@@ -0,0 +1,96 @@
+//--------------------------------------------------
+// Startup code for expanding a packed frame container back into images
+//
+// @author: Wild Boar
+//
+// @date: 2026-10-18
+//--------------------------------------------------
+
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+#include <opencv2/opencv.hpp>
+using namespace cv;
+
+#include <NVLib/FileUtils.h>
+
+#include <VidExtractLib/PackReader.h>
+#include <VidExtractLib/FolderSink.h>
+using namespace NVL_Module;
+
+//--------------------------------------------------
+// Function Prototypes
+//--------------------------------------------------
+void Run(const string& packFile, const string& outputFolder, bool list);
+
+//--------------------------------------------------
+// Execution entry point
+//--------------------------------------------------
+
+/**
+ * Main Method
+ * @param argc The count of the incomming arguments
+ * @param argv The number of incomming arguments
+ */
+int main(int argc, char ** argv) 
+{
+    const char * keys = 
+        "{help h usage ? |      | Show help message }"
+        "{@pack_file     |      | The container (.vxp) that is being expanded }"
+        "{@output_folder |      | The folder that the images are written to }"
+        "{list           | false| List the frames instead of writing them }";
+
+    auto parser = CommandLineParser(argc, argv, keys);
+    parser.about("VidUnpack v1.0.0");
+
+    try
+    {
+        auto packFile = parser.get<string>(0); auto outputFolder = parser.get<string>(1); auto list = parser.get<bool>("list");
+        if (packFile == string() || (outputFolder == string() && !list)) throw runtime_error("USAGE: VidUnpack <pack_file> <output_folder> [--list]");
+        Run(packFile, outputFolder, list);
+    }
+    catch (runtime_error exception)
+    {
+        cerr << "Error: " << exception.what() << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+//--------------------------------------------------
+// Expansion
+//--------------------------------------------------
+
+/**
+ * @brief Write each frame of the container to its own file (the encoded bytes are copied, not re-encoded)
+ * @param packFile The container that is being expanded
+ * @param outputFolder The folder that the images are written to
+ * @param list Print the index of the container instead of writing the frames
+ */
+void Run(const string& packFile, const string& outputFolder, bool list) 
+{
+    auto reader = PackReader(packFile);
+    if (!list) NVLib::FileUtils::AddFolders(outputFolder);
+
+    for (size_t position = 0; position < reader.GetCount(); position++) 
+    {
+        auto entry = reader.GetEntry(position);
+        auto fileName = FolderSink::GetFileName((int)entry.GetIndex());
+
+        if (list) 
+        {
+            cout << fileName << "\tframe " << entry.GetFrame() << "\t" << entry.GetTimestamp() << " ms\t" << entry.GetSize() << " bytes" << endl;
+            continue;
+        }
+
+        size_t size; auto data = reader.GetData(position, size);
+        auto path = NVLib::FileUtils::PathCombine(outputFolder, fileName);
+        auto writer = ofstream(path, ios::binary);
+        if (!writer.is_open()) throw runtime_error("Unable to open: " + path);
+        writer.write((const char *) data, size);
+    }
+
+    cout << "Frames: " << reader.GetCount() << endl;
+}